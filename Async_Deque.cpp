@@ -0,0 +1,124 @@
+#include "Async_Deque.h"
+
+template <typename T>
+AsyncDeque<T>::AsyncDeque(Executor& executor, size_t capacity)
+    : items{}, poppers{}, pushers{}, capacity{capacity == 0 ? 1 : capacity}, executor{executor} {}
+
+// Take a value if one is available, otherwise queue up and suspend.
+// Taking a value frees a slot, so the oldest waiting pusher gets to store its value
+// and is resumed directly, without going through the executor.
+template <typename T>
+bool AsyncDeque<T>::PopAwaiter::await_suspend(std::coroutine_handle<> _handle) {
+    std::coroutine_handle<> wake;
+    {
+        std::lock_guard<std::mutex> guard(channel.lock);
+        if (channel.items.empty()) {
+            handle = _handle;
+            channel.poppers.push_back(this);
+            return true;
+        }
+        value.emplace(std::move(channel.items.unchecked_front()));
+        channel.items.unchecked_pop_front();
+        PushAwaiter* pusher;
+        if (channel.pushers.try_pop_front(pusher)) {
+            channel.items.push_back(std::move(pusher->value));
+            wake = pusher->handle;
+        }
+    }
+    // The peer runs on this thread until it next suspends, then this coroutine carries on
+    if (wake) {
+        wake.resume();
+    }
+    return false;
+}
+
+// Hand the value to a waiting popper, store it if there is room, otherwise suspend
+template <typename T>
+bool AsyncDeque<T>::PushAwaiter::await_suspend(std::coroutine_handle<> _handle) {
+    std::coroutine_handle<> wake;
+    {
+        std::lock_guard<std::mutex> guard(channel.lock);
+        PopAwaiter* popper;
+        if (channel.poppers.try_pop_front(popper)) {
+            popper->value.emplace(std::move(value));
+            wake = popper->handle;
+        } else if (channel.items.size() < channel.capacity) {
+            channel.items.push_back(std::move(value));
+        } else {
+            handle = _handle;
+            channel.pushers.push_back(this);
+            return true;
+        }
+    }
+    // The peer runs on this thread until it next suspends, then this coroutine carries on
+    if (wake) {
+        wake.resume();
+    }
+    return false;
+}
+
+template <typename T>
+typename AsyncDeque<T>::PopAwaiter AsyncDeque<T>::pop_front() {
+    return PopAwaiter(*this);
+}
+
+template <typename T>
+typename AsyncDeque<T>::PushAwaiter AsyncDeque<T>::push_back(const T& val) {
+    return PushAwaiter(*this, val);
+}
+
+template <typename T>
+bool AsyncDeque<T>::try_push_back(const T& val) {
+    std::coroutine_handle<> wake;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        PopAwaiter* popper;
+        if (poppers.try_pop_front(popper)) {
+            popper->value.emplace(val);
+            wake = popper->handle;
+        } else if (items.size() < capacity) {
+            items.push_back(val);
+        } else {
+            return false;
+        }
+    }
+    if (wake) {
+        executor.post(wake);
+    }
+    return true;
+}
+
+template <typename T>
+std::optional<T> AsyncDeque<T>::try_pop_front() {
+    std::optional<T> out;
+    std::coroutine_handle<> wake;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (items.empty()) {
+            return out;
+        }
+        out.emplace(std::move(items.unchecked_front()));
+        items.unchecked_pop_front();
+        PushAwaiter* pusher;
+        if (pushers.try_pop_front(pusher)) {
+            items.push_back(std::move(pusher->value));
+            wake = pusher->handle;
+        }
+    }
+    if (wake) {
+        executor.post(wake);
+    }
+    return out;
+}
+
+template <typename T>
+size_t AsyncDeque<T>::size() {
+    std::lock_guard<std::mutex> guard(lock);
+    return items.size();
+}
+
+template <typename T>
+bool AsyncDeque<T>::empty() {
+    std::lock_guard<std::mutex> guard(lock);
+    return items.empty();
+}
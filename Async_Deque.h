@@ -0,0 +1,79 @@
+#ifndef ASYNC_DEQUE_H
+#define ASYNC_DEQUE_H
+
+#include <coroutine>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include "Async_Executor.h"
+#include "Deque.h"
+
+// Bounded channel for C++20 coroutines on top of Deque.
+// co_await pop_front() waits while the channel is empty and co_await push_back(v)
+// waits while it is full. A push hands its value straight to a waiting popper
+// (and a pop pulls straight from a waiting pusher) and resumes it inline on the
+// current thread. Only the non-coroutine try_ operations, which may be called
+// from any thread, hand woken waiters to the channel's executor.
+template <typename T>
+class AsyncDeque {
+    private:
+        class PopAwaiter;
+        class PushAwaiter;
+
+        Deque<T> items;
+        Deque<PopAwaiter*> poppers;  // Suspended pop_front calls, oldest first
+        Deque<PushAwaiter*> pushers; // Suspended push_back calls, oldest first
+        size_t capacity;
+        Executor& executor;
+        std::mutex lock;
+
+        class PopAwaiter {
+            private:
+                friend AsyncDeque;
+                AsyncDeque& channel;
+                std::optional<T> value;
+                std::coroutine_handle<> handle;
+
+            public:
+                explicit PopAwaiter(AsyncDeque& _channel) : channel{_channel} {}
+                bool await_ready() const noexcept { return false; }
+                bool await_suspend(std::coroutine_handle<> _handle);
+                T await_resume() { return std::move(*value); }
+        };
+
+        class PushAwaiter {
+            private:
+                friend AsyncDeque;
+                AsyncDeque& channel;
+                T value;
+                std::coroutine_handle<> handle;
+
+            public:
+                PushAwaiter(AsyncDeque& _channel, const T& _value) : channel{_channel}, value{_value} {}
+                bool await_ready() const noexcept { return false; }
+                bool await_suspend(std::coroutine_handle<> _handle);
+                void await_resume() const noexcept {}
+        };
+
+    public:
+        // Constructors
+        explicit AsyncDeque(Executor& executor, size_t capacity = std::numeric_limits<size_t>::max());
+        AsyncDeque(const AsyncDeque&) = delete;
+        AsyncDeque& operator=(const AsyncDeque&) = delete;
+
+        // Awaitable operations
+        PopAwaiter pop_front();
+        PushAwaiter push_back(const T& val);
+
+        // Non-blocking operations
+        bool try_push_back(const T& val);
+        std::optional<T> try_pop_front();
+
+        // Capacity
+        size_t size();
+        bool empty();
+};
+
+#include "Async_Deque.cpp"
+#endif //ASYNC_DEQUE_H
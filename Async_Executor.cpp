@@ -0,0 +1,74 @@
+#include "Async_Executor.h"
+
+inline Executor::ScheduleAwaiter Executor::schedule() {
+    return ScheduleAwaiter{*this};
+}
+
+inline void ManualExecutor::post(std::coroutine_handle<> handle) {
+    std::lock_guard<std::mutex> guard(lock);
+    ready.push_back(handle);
+}
+
+inline bool ManualExecutor::run_one() {
+    std::coroutine_handle<> handle;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (!ready.try_pop_front(handle)) {
+            return false;
+        }
+    }
+    handle.resume();
+    return true;
+}
+
+inline size_t ManualExecutor::run() {
+    size_t count = 0;
+    while (run_one()) {
+        ++count;
+    }
+    return count;
+}
+
+inline ThreadPoolExecutor::ThreadPoolExecutor(size_t threads) : stopping{false} {
+    if (threads == 0) {
+        threads = 1;
+    }
+    workers.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        workers.emplace_back([this] { work(); });
+    }
+}
+
+// Finish the queued work, then stop the workers
+inline ThreadPoolExecutor::~ThreadPoolExecutor() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    work_ready.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+inline void ThreadPoolExecutor::post(std::coroutine_handle<> handle) {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        ready.push_back(handle);
+    }
+    work_ready.notify_one();
+}
+
+inline void ThreadPoolExecutor::work() {
+    for (;;) {
+        std::coroutine_handle<> handle;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            work_ready.wait(guard, [this] { return stopping || !ready.empty(); });
+            if (!ready.try_pop_front(handle)) {
+                return;
+            }
+        }
+        handle.resume();
+    }
+}
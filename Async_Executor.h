@@ -0,0 +1,73 @@
+#ifndef ASYNC_EXECUTOR_H
+#define ASYNC_EXECUTOR_H
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Deque.h"
+
+// Something that resumes coroutine handles
+class Executor {
+    public:
+        virtual ~Executor() = default;
+        virtual void post(std::coroutine_handle<> handle) = 0;
+
+        // co_await executor.schedule() moves the awaiting coroutine onto this executor
+        struct ScheduleAwaiter {
+            Executor& executor;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) { executor.post(handle); }
+            void await_resume() const noexcept {}
+        };
+        ScheduleAwaiter schedule();
+};
+
+// Single-threaded executor: handles run on whichever thread calls run()
+class ManualExecutor : public Executor {
+    private:
+        Deque<std::coroutine_handle<>> ready;
+        std::mutex lock;
+
+    public:
+        void post(std::coroutine_handle<> handle) override;
+        bool run_one();   // Resume one ready handle, false if there was none
+        size_t run();     // Resume handles until none are ready, returns how many ran
+};
+
+// Fixed pool of worker threads sharing one ready queue
+class ThreadPoolExecutor : public Executor {
+    private:
+        Deque<std::coroutine_handle<>> ready;
+        std::mutex lock;
+        std::condition_variable work_ready;
+        std::vector<std::thread> workers;
+        bool stopping;
+
+        void work();
+
+    public:
+        explicit ThreadPoolExecutor(size_t threads = std::thread::hardware_concurrency());
+        ~ThreadPoolExecutor() override;
+        ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+        ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+        void post(std::coroutine_handle<> handle) override;
+};
+
+// Fire-and-forget coroutine: starts eagerly and frees its frame when it finishes
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+};
+
+#include "Async_Executor.cpp"
+#endif //ASYNC_EXECUTOR_H
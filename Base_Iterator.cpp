@@ -1,26 +1,36 @@
 #include "Base_Iterator.h"
 
 template <typename T, bool IsConst, bool IsReverse>
-BaseIterator<T, IsConst, IsReverse>::BaseIterator() = default;
+BaseIterator<T, IsConst, IsReverse>::BaseIterator()
+    : curr{nullptr}, first{nullptr}, last{nullptr}, node{nullptr}, map_first{nullptr}, map_last{nullptr} {}
 
+// An iterator built from raw chunk pointers cannot leave its chunk
 template <typename T, bool IsConst, bool IsReverse>
 BaseIterator<T, IsConst, IsReverse>::BaseIterator(
     pointer _curr, pointer _first, pointer _last, Chunkpointer _node)
-    : curr{_curr}, first{_first}, last{_last}, node{_node} {}
+    : curr{_curr}, first{_first}, last{_last}, node{_node}, map_first{_node}, map_last{_node} {}
+
+template <typename T, bool IsConst, bool IsReverse>
+BaseIterator<T, IsConst, IsReverse>::BaseIterator(
+    pointer _curr, Chunkpointer _node, Chunkpointer _map_first, Chunkpointer _map_last)
+    : curr{_curr}, first{_node->get()}, last{_node->get() + CHUNK_SIZE - 1}, node{_node},
+      map_first{_map_first}, map_last{_map_last} {}
 
 template <typename T, bool IsConst, bool IsReverse>
 BaseIterator<T, IsConst, IsReverse>::BaseIterator(pointer T_ptr)
-    : curr{T_ptr}, first{nullptr}, last{nullptr}, node{nullptr} {}
+    : curr{T_ptr}, first{nullptr}, last{nullptr}, node{nullptr}, map_first{nullptr}, map_last{nullptr} {}
 
 template <typename T, bool IsConst, bool IsReverse>
 BaseIterator<T, IsConst, IsReverse>::BaseIterator(const BaseIterator& other) noexcept 
-    : curr{other.curr}, first{other.first}, last{other.last}, node{other.node} {}
+    : curr{other.curr}, first{other.first}, last{other.last}, node{other.node},
+      map_first{other.map_first}, map_last{other.map_last} {}
 
 template <typename T, bool IsConst, bool IsReverse>
 BaseIterator<T, IsConst, IsReverse>::BaseIterator(BaseIterator&& other) noexcept 
-    : curr{other.curr}, first{other.first}, last{other.last}, node{other.node} {
+    : curr{other.curr}, first{other.first}, last{other.last}, node{other.node},
+      map_first{other.map_first}, map_last{other.map_last} {
     other.curr = other.first = other.last = nullptr;
-    other.node = nullptr;
+    other.node = other.map_first = other.map_last = nullptr;
 }
 
 template <typename T, bool IsConst, bool IsReverse>
@@ -31,6 +41,8 @@ BaseIterator<T, IsConst, IsReverse>::operator=(const BaseIterator& other) noexce
         first = other.first;
         last = other.last;
         node = other.node;
+        map_first = other.map_first;
+        map_last = other.map_last;
     }
     return *this;
 }
@@ -43,79 +55,93 @@ BaseIterator<T, IsConst, IsReverse>::operator=(BaseIterator&& other) noexcept {
         first = other.first;
         last = other.last;
         node = other.node;
+        map_first = other.map_first;
+        map_last = other.map_last;
         other.curr = other.first = other.last = nullptr;
-        other.node = nullptr;
+        other.node = other.map_first = other.map_last = nullptr;
     }
     return *this;
 }
+
 template <typename T, bool IsConst, bool IsReverse>
-void BaseIterator<T, IsConst, IsReverse>::increment() {
-    if constexpr (!IsReverse) {
-        ++curr;
-        if (curr > last) {
-            ++node;
-            if (node == nullptr || *node == nullptr) {
-                curr = nullptr;
-            } else {
-                first = *node;
-                last = first + CHUNK_SIZE - 1;
-                curr = first;
-            }
-        }
-    } else {
-        --curr;
-        if (curr < first) {
-            --node;
-            if (node == nullptr || *node == nullptr) {
-                curr = nullptr;
-            } else {
-                first = *node;
-                last = first + CHUNK_SIZE - 1;
-                curr = last;
+void BaseIterator<T, IsConst, IsReverse>::enter(Chunkpointer _node) {
+    node = _node;
+    first = node->get();
+    last = first + CHUNK_SIZE - 1;
+}
+
+// Crossing into the next chunk also prefetches the data of the chunk
+// PREFETCH_DISTANCE further along, like the segment walks do
+template <typename T, bool IsConst, bool IsReverse>
+void BaseIterator<T, IsConst, IsReverse>::step_forward() {
+    ++curr;
+    if (curr > last && node < map_last) {
+        enter(node + 1);
+        curr = first;
+        if constexpr (PREFETCH_DISTANCE > 0) {
+            if (map_last - node >= static_cast<difference_type>(PREFETCH_DISTANCE)) {
+                prefetch_chunk((node + PREFETCH_DISTANCE)->get(), CHUNK_SIZE);
             }
         }
     }
 }
 
 template <typename T, bool IsConst, bool IsReverse>
-void BaseIterator<T, IsConst, IsReverse>::decrement() {
-    if constexpr (!IsReverse) {
-        --curr;
-        if (curr < first) {
-            --node;
-            if (node == nullptr || *node == nullptr) {
-                curr = nullptr;
-            } else {
-                first = *node;
-                last = first + CHUNK_SIZE - 1;
-                curr = last;
+void BaseIterator<T, IsConst, IsReverse>::step_backward() {
+    --curr;
+    if (curr < first && node > map_first) {
+        enter(node - 1);
+        curr = last;
+        if constexpr (PREFETCH_DISTANCE > 0) {
+            if (node - map_first >= static_cast<difference_type>(PREFETCH_DISTANCE)) {
+                prefetch_chunk((node - PREFETCH_DISTANCE)->get(), CHUNK_SIZE);
             }
         }
+    }
+}
+
+// Move n elements in storage order in O(1)
+template <typename T, bool IsConst, bool IsReverse>
+void BaseIterator<T, IsConst, IsReverse>::advance(difference_type n) {
+    constexpr difference_type chunk = CHUNK_SIZE;
+    difference_type offset = (curr - first) + n;
+    if (offset >= 0 && offset < chunk) {
+        curr += n;
+        return;
+    }
+    difference_type chunks = offset >= 0 ? offset / chunk : -((-offset - 1) / chunk) - 1;
+    if (chunks > map_last - node) {
+        chunks = map_last - node;
+    } else if (chunks < map_first - node) {
+        chunks = map_first - node;
+    }
+    enter(node + chunks);
+    curr = first + (offset - chunks * chunk);
+}
+
+template <typename T, bool IsConst, bool IsReverse>
+void BaseIterator<T, IsConst, IsReverse>::increment() {
+    if constexpr (IsReverse) {
+        step_backward();
     } else {
-        ++curr;
-        if (curr > last) {
-            ++node;
-            if (node == nullptr || *node == nullptr) {
-                curr = nullptr;
-            } else {
-                first = *node;
-                last = first + CHUNK_SIZE - 1;
-                curr = first;
-            }
-        }
+        step_forward();
     }
 }
 
+template <typename T, bool IsConst, bool IsReverse>
+void BaseIterator<T, IsConst, IsReverse>::decrement() {
+    if constexpr (IsReverse) {
+        step_forward();
+    } else {
+        step_backward();
+    }
+}
 
 template <typename T, bool IsConst, bool IsReverse>
 BaseIterator<T, IsConst, IsReverse> 
 BaseIterator<T, IsConst, IsReverse>::operator+(difference_type n) const {
     BaseIterator temp = *this;
-    if constexpr (IsReverse) {
-        temp -= n;
-    } else {
-        temp += n;
-    }
+    temp += n;
     return temp;
 }
 
@@ -123,32 +149,17 @@ template <typename T, bool IsConst, bool IsReverse>
 BaseIterator<T, IsConst, IsReverse> 
 BaseIterator<T, IsConst, IsReverse>::operator-(difference_type n) const {
     BaseIterator temp = *this;
-    if constexpr (IsReverse) {
-        temp += n;
-    } else {
-        temp -= n;
-    }
+    temp -= n;
     return temp;
 }
 
+// Distance in traversal order; chunks between the two are full
 template <typename T, bool IsConst, bool IsReverse>
 typename BaseIterator<T, IsConst, IsReverse>::difference_type 
 BaseIterator<T, IsConst, IsReverse>::operator-(const BaseIterator& other) const {
-    if (node == other.node) {
-        return curr - other.curr;
-    }
-    
-    BaseIterator start = (node < other.node) ? *this : other;
-    BaseIterator end = (node < other.node) ? other : *this;
-    
-    difference_type diff = 
-        (start.last - start.curr + 1) +
-        (end.curr - end.first) +
-        ((end.node - start.node - 1) * CHUNK_SIZE);
-    
-    return (node < other.node) ? 
-        (IsReverse ? -diff : diff) : 
-        (IsReverse ? diff : -diff);
+    difference_type diff = (node - other.node) * static_cast<difference_type>(CHUNK_SIZE) +
+                           (curr - first) - (other.curr - other.first);
+    return IsReverse ? -diff : diff;
 }
 
 template <typename T, bool IsConst, bool IsReverse>
@@ -184,55 +195,14 @@ BaseIterator<T, IsConst, IsReverse>::operator--(int) {
 template <typename T, bool IsConst, bool IsReverse>
 BaseIterator<T, IsConst, IsReverse>& 
 BaseIterator<T, IsConst, IsReverse>::operator+=(difference_type n) {
-    if constexpr (IsReverse) {
-        if (n >= 0) {
-            difference_type block_size = last - first + 1;
-            difference_type blocks_to_jump = n / block_size;
-            difference_type offset_in_block = n % block_size;
-
-            node -= blocks_to_jump;
-            first = *node;
-            last = first + CHUNK_SIZE - 1;
-            curr = last - offset_in_block;
-        } else {
-            return operator-= (-n);
-        }
-    } else {
-        if (n >= 0) {
-            difference_type block_size = last - first + 1;
-            difference_type blocks_to_jump = n / block_size;
-            difference_type offset_in_block = n % block_size;
-
-            node += blocks_to_jump;
-            first = *node;
-            last = first + CHUNK_SIZE - 1;
-            curr = first + offset_in_block;
-        } else {
-            return operator-= (-n);
-        }
-    }
+    advance(IsReverse ? -n : n);
     return *this;
 }
 
 template <typename T, bool IsConst, bool IsReverse>
 BaseIterator<T, IsConst, IsReverse>& 
 BaseIterator<T, IsConst, IsReverse>::operator-=(difference_type n) {
-    if constexpr (IsReverse) {
-        return operator+=(-n);
-    } else {
-        if (n >= 0) {
-            difference_type block_size = last - first + 1;
-            difference_type blocks_to_jump = n / block_size;
-            difference_type offset_in_block = n % block_size;
-
-            node -= blocks_to_jump;
-            first = *node;
-            last = first + CHUNK_SIZE - 1;
-            curr = last - offset_in_block;
-        } else {
-            return operator+=(-n);
-        }
-    }
+    advance(IsReverse ? n : -n);
     return *this;
 }
 
@@ -3,10 +3,33 @@
 
 #include <iterator>
 #include <cstddef>
+#include <algorithm>
+#include "Chunk_Pool.h"
 #include "Deque.h"
 template <typename T>
 class Deque;
 
+#ifndef DEQUE_PREFETCH_DISTANCE
+#define DEQUE_PREFETCH_DISTANCE 2 // Chunks ahead of a traversal to prefetch, 0 disables
+#endif
+
+// Cache hints used by traversals when they are about to move to another chunk
+inline void prefetch_address(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+#endif
+}
+
+// Prefetch the leading cache lines (at most 1 KB) of a chunk
+template <typename T>
+inline void prefetch_chunk(const T* chunk, size_t chunk_size) {
+    const char* bytes = reinterpret_cast<const char*>(chunk);
+    size_t length = std::min<size_t>(chunk_size * sizeof(T), 1024);
+    for (size_t offset = 0; offset < length; offset += 64) {
+        prefetch_address(bytes + offset);
+    }
+}
+
 template <typename T, bool IsConst = false, bool IsReverse = false>
 class BaseIterator {
     public:
@@ -17,15 +40,25 @@ class BaseIterator {
     using reference = std::conditional_t<IsConst, const T&, T&>;
     using const_reference = const T&;
     using pointer = std::conditional_t<IsConst, const T*, T*>;
-    using Chunkpointer = std::conditional_t<IsConst, const T**, T**>;
+    using Chunkpointer = std::conditional_t<IsConst, const Chunk<T>*, Chunk<T>*>;
     
     private:    
     friend Deque<T>;
     static constexpr size_t CHUNK_SIZE = 128;
+    static constexpr size_t PREFETCH_DISTANCE = DEQUE_PREFETCH_DISTANCE;
     pointer curr;
     pointer first;
     pointer last;
     Chunkpointer node;
+    Chunkpointer map_first; // First and last chunk the iterator may step into
+    Chunkpointer map_last;
+
+    // Movement in storage order; past either end of the map the iterator stays
+    // on the boundary chunk, one slot outside it
+    void step_forward();
+    void step_backward();
+    void advance(difference_type n);
+    void enter(Chunkpointer _node);
 
     void increment();
     void decrement();
@@ -33,6 +66,7 @@ class BaseIterator {
 public:
     BaseIterator();
     BaseIterator(pointer _curr, pointer _first, pointer _last, Chunkpointer _node);
+    BaseIterator(pointer _curr, Chunkpointer _node, Chunkpointer _map_first, Chunkpointer _map_last);
     BaseIterator(pointer T_ptr);
     BaseIterator(const BaseIterator& other) noexcept;
     BaseIterator(BaseIterator&& other) noexcept;
@@ -0,0 +1,165 @@
+#include "Blocking_Deque.h"
+#include <algorithm>
+#include <climits>
+#include <mutex>
+#include <thread>
+#include <time.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#ifdef SYS_futex
+#include <linux/futex.h>
+#endif
+
+inline void SpinLock::lock() noexcept {
+    for (;;) {
+        if (!locked.exchange(true, std::memory_order_acquire)) {
+            return;
+        }
+        while (locked.load(std::memory_order_relaxed)) {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+        }
+    }
+}
+
+inline bool SpinLock::try_lock() noexcept {
+    return !locked.load(std::memory_order_relaxed) && !locked.exchange(true, std::memory_order_acquire);
+}
+
+inline void SpinLock::unlock() noexcept {
+    locked.store(false, std::memory_order_release);
+}
+
+template <typename T>
+BlockingDeque<T>::BlockingDeque() : items{}, lock{}, sequence{0}, sleepers{0} {}
+
+// Publish a push to consumers, only entering the kernel when someone is asleep
+template <typename T>
+void BlockingDeque<T>::notify(size_t count) {
+    sequence.fetch_add(1, std::memory_order_seq_cst);
+    if (sleepers.load(std::memory_order_seq_cst) == 0) {
+        return;
+    }
+#ifdef SYS_futex
+    int wake = count > static_cast<size_t>(INT_MAX) ? INT_MAX : static_cast<int>(count);
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&sequence), FUTEX_WAKE_PRIVATE, wake, nullptr, nullptr, 0);
+#else
+    (void)count;
+#endif
+}
+
+// Sleep until the sequence moves past observed or the deadline passes.
+// Returns false on timeout. Spurious wakeups are fine, callers re-check the queue.
+template <typename T>
+bool BlockingDeque<T>::wait(uint32_t observed, std::chrono::steady_clock::time_point deadline) {
+    for (int spin = 0; spin < SPIN_LIMIT; ++spin) {
+        if (sequence.load(std::memory_order_acquire) != observed) {
+            return true;
+        }
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (now >= deadline) {
+        return false;
+    }
+    sleepers.fetch_add(1, std::memory_order_seq_cst);
+    if (sequence.load(std::memory_order_seq_cst) == observed) {
+#ifdef SYS_futex
+        auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now);
+        timespec relative{};
+        timespec* timeout = nullptr;
+        if (deadline != std::chrono::steady_clock::time_point::max()) {
+            relative.tv_sec = static_cast<time_t>(remaining.count() / 1000000000);
+            relative.tv_nsec = static_cast<long>(remaining.count() % 1000000000);
+            timeout = &relative;
+        }
+        ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&sequence), FUTEX_WAIT_PRIVATE, observed, timeout, nullptr, 0);
+#else
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+#endif
+    }
+    sleepers.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+// Move up to max elements out of the front, caller holds the lock
+template <typename T>
+size_t BlockingDeque<T>::take(T* dest, size_t max) {
+    size_t n = std::min(max, items.size());
+    for (size_t i = 0; i < n; ++i) {
+        dest[i] = std::move(items.unchecked_front());
+        items.unchecked_pop_front();
+    }
+    return n;
+}
+
+template <typename T>
+void BlockingDeque<T>::push(const T& val) {
+    {
+        std::lock_guard<SpinLock> guard(lock);
+        items.push_back(val);
+    }
+    notify(1);
+}
+
+template <typename T>
+void BlockingDeque<T>::push_batch(const T* src, size_t n) {
+    if (n == 0) {
+        return;
+    }
+    {
+        std::lock_guard<SpinLock> guard(lock);
+        items.append(src, n);
+    }
+    notify(n);
+}
+
+template <typename T>
+bool BlockingDeque<T>::try_pop(T& out) {
+    std::lock_guard<SpinLock> guard(lock);
+    return take(&out, 1) == 1;
+}
+
+template <typename T>
+bool BlockingDeque<T>::pop(T& out, std::chrono::nanoseconds timeout) {
+    return pop_batch(&out, 1, timeout) == 1;
+}
+
+template <typename T>
+size_t BlockingDeque<T>::pop_batch(T* dest, size_t max, std::chrono::nanoseconds timeout) {
+    if (max == 0) {
+        return 0;
+    }
+    auto now = std::chrono::steady_clock::now();
+    auto deadline = timeout >= std::chrono::steady_clock::time_point::max() - now
+                        ? std::chrono::steady_clock::time_point::max()
+                        : now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+    for (;;) {
+        // Read the sequence before checking, so a push after the check is never missed
+        uint32_t observed = sequence.load(std::memory_order_acquire);
+        {
+            std::lock_guard<SpinLock> guard(lock);
+            size_t n = take(dest, max);
+            if (n > 0) {
+                return n;
+            }
+        }
+        if (!wait(observed, deadline)) {
+            return 0;
+        }
+    }
+}
+
+template <typename T>
+size_t BlockingDeque<T>::size() const {
+    std::lock_guard<SpinLock> guard(lock);
+    return items.size();
+}
+
+template <typename T>
+bool BlockingDeque<T>::empty() const {
+    return size() == 0;
+}
@@ -0,0 +1,60 @@
+#ifndef BLOCKING_DEQUE_H
+#define BLOCKING_DEQUE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include "Deque.h"
+
+// Test-and-test-and-set lock for the short critical sections of BlockingDeque
+class SpinLock {
+    private:
+        std::atomic<bool> locked{false};
+
+    public:
+        void lock() noexcept;
+        bool try_lock() noexcept;
+        void unlock() noexcept;
+};
+
+// Multi-producer multi-consumer queue over Deque guarded by a spinlock.
+// Batch operations take the lock once per batch. Consumers that find the queue
+// empty spin briefly, then sleep on a futex word that producers bump on every push.
+template <typename T>
+class BlockingDeque {
+    private:
+        static constexpr int SPIN_LIMIT = 256;  // Empty polls before sleeping
+
+        Deque<T> items;
+        mutable SpinLock lock;
+        std::atomic<uint32_t> sequence; // Futex word, bumped on every push
+        std::atomic<uint32_t> sleepers; // Consumers blocked in wait()
+
+        void notify(size_t count);
+        bool wait(uint32_t observed, std::chrono::steady_clock::time_point deadline);
+        size_t take(T* dest, size_t max);
+
+    public:
+        BlockingDeque();
+        BlockingDeque(const BlockingDeque&) = delete;
+        BlockingDeque& operator=(const BlockingDeque&) = delete;
+
+        // Producers
+        void push(const T& val);
+        void push_batch(const T* src, size_t n);
+
+        // Consumers
+        bool try_pop(T& out);
+        bool pop(T& out, std::chrono::nanoseconds timeout = std::chrono::nanoseconds::max());
+        // Wait up to timeout for at least one element, then move up to max into dest.
+        // Returns the number moved, 0 on timeout.
+        size_t pop_batch(T* dest, size_t max, std::chrono::nanoseconds timeout = std::chrono::nanoseconds::max());
+
+        // Capacity
+        size_t size() const;
+        bool empty() const;
+};
+
+#include "Blocking_Deque.cpp"
+#endif //BLOCKING_DEQUE_H
@@ -0,0 +1,87 @@
+#include "Byte_Deque.h"
+
+// Append n bytes to the back
+inline void ByteDeque::write(const void* src, size_t n) {
+    bytes.append(static_cast<const std::byte*>(src), n);
+}
+
+// Remove up to n bytes from the front into dest
+inline size_t ByteDeque::read(void* dest, size_t n) {
+    n = peek(dest, n);
+    bytes.consume_front(n);
+    return n;
+}
+
+// Copy up to n bytes starting at offset without consuming them
+inline size_t ByteDeque::peek(void* dest, size_t n, size_t offset) const {
+    if (offset >= bytes.num_elements) {
+        return 0;
+    }
+    n = std::min(n, bytes.num_elements - offset);
+    bytes.copy_out(offset, static_cast<std::byte*>(dest), n);
+    return n;
+}
+
+inline void ByteDeque::discard(size_t n) {
+    bytes.consume_front(std::min(n, bytes.num_elements));
+}
+
+inline void ByteDeque::clear() {
+    bytes.consume_front(bytes.num_elements);
+}
+
+// Write buffered bytes to fd straight from the chunks, then drop what was written
+inline ssize_t ByteDeque::read_into(int fd, size_t max) {
+    iovec iov[MAX_IOV];
+    size_t count = export_iovec(bytes, iov, MAX_IOV, 0, max);
+    if (count == 0) {
+        return 0;
+    }
+    ssize_t written;
+    do {
+        written = ::writev(fd, iov, static_cast<int>(count));
+    } while (written < 0 && errno == EINTR);
+    if (written > 0) {
+        bytes.consume_front(static_cast<size_t>(written));
+    }
+    return written;
+}
+
+// readv straight into the free room past the back, then grow by what arrived. The room
+// is reserved as spare chunks, so a short read leaves the chunk map untouched and the
+// unused chunks wait for the next call instead of being freed.
+inline ssize_t ByteDeque::write_from(int fd, size_t max) {
+    if (max == 0) {
+        return 0;
+    }
+    // One readv fills at most MAX_IOV chunks, so never ask for more than that
+    max = std::min(max, (MAX_IOV - 1) * Deque<std::byte>::CHUNK_SIZE);
+    bytes.reserve_back(max);
+    iovec iov[MAX_IOV];
+    size_t count = 0;
+    bytes.for_each_back_room(max, [&](std::byte* data, size_t length) {
+        iov[count].iov_base = data;
+        iov[count].iov_len = length;
+        ++count;
+    });
+    ssize_t got;
+    do {
+        got = ::readv(fd, iov, static_cast<int>(count));
+    } while (got < 0 && errno == EINTR);
+    if (got > 0) {
+        bytes.extend_back(static_cast<size_t>(got));
+    }
+    return got;
+}
+
+inline std::vector<std::span<const std::byte>> ByteDeque::spans() const {
+    return bytes.export_spans();
+}
+
+inline bool ByteDeque::empty() const {
+    return bytes.num_elements == 0;
+}
+
+inline size_t ByteDeque::size() const {
+    return bytes.num_elements;
+}
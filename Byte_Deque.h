@@ -0,0 +1,46 @@
+#ifndef BYTE_DEQUE_H
+#define BYTE_DEQUE_H
+
+#include <cstddef>
+#include <sys/types.h>
+#include "Deque_IO.h"
+
+// FIFO byte buffer on top of Deque<std::byte>.
+// Data moves in and out a chunk at a time with memcpy, readv and writev.
+class ByteDeque {
+    private:
+        static constexpr size_t MAX_IOV = 1024; // iovecs handed to one readv/writev call
+
+        Deque<std::byte> bytes;
+
+    public:
+        // Constructors
+        ByteDeque() = default;
+        ByteDeque(const ByteDeque& other) = default;
+        ByteDeque(ByteDeque&& other) noexcept = default;
+
+        // Assignment operators
+        ByteDeque& operator=(const ByteDeque& other) = default;
+        ByteDeque& operator=(ByteDeque&& other) noexcept = default;
+
+        // Buffer operations
+        void write(const void* src, size_t n);     // Append n bytes
+        size_t read(void* dest, size_t n);         // Remove up to n bytes from the front, returns count
+        size_t peek(void* dest, size_t n, size_t offset = 0) const; // Copy without removing
+        void discard(size_t n);                    // Drop up to n bytes from the front
+        void clear();
+
+        // File descriptor I/O, returning the syscall result (-1 and errno on failure)
+        ssize_t read_into(int fd, size_t max = std::numeric_limits<size_t>::max()); // Drain to fd with writev
+        ssize_t write_from(int fd, size_t max);    // Fill from fd with readv
+
+        // Scatter-gather view of the buffered bytes
+        std::vector<std::span<const std::byte>> spans() const;
+
+        // Capacity
+        bool empty() const;
+        size_t size() const;
+};
+
+#include "Byte_Deque.cpp"
+#endif //BYTE_DEQUE_H
@@ -0,0 +1,96 @@
+#include "Chunk_Allocator.h"
+#include <cstdint>
+#include <map>
+#include <new>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Pools are created on first use and deliberately never destroyed, so chunks
+// still owned by static deques can be returned during shutdown
+template <typename T>
+ChunkSlab<T>& ChunkSlab<T>::instance(int numa_node) {
+    static std::mutex registry_lock;
+    static auto* registry = new std::map<int, ChunkSlab*>();
+    std::lock_guard<std::mutex> guard(registry_lock);
+    ChunkSlab*& slab = (*registry)[numa_node];
+    if (!slab) {
+        slab = new ChunkSlab(numa_node);
+    }
+    return *slab;
+}
+
+template <typename T>
+ChunkSlab<T>::ChunkSlab(int numa_node) : node{numa_node}, bump{nullptr}, bump_end{nullptr} {}
+
+// Map a fresh huge-page aligned slab and make it the bump region
+template <typename T>
+void ChunkSlab<T>::map_slab() {
+    // Over-map by one huge page so the slab can be aligned to it
+    size_t length = MAPPING_SIZE + SLAB_SIZE;
+    void* raw = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    char* base = static_cast<char*>(raw);
+    char* aligned = reinterpret_cast<char*>(
+        (reinterpret_cast<uintptr_t>(base) + SLAB_SIZE - 1) & ~(uintptr_t(SLAB_SIZE) - 1));
+    if (aligned > base) {
+        ::munmap(base, aligned - base);
+    }
+    char* tail = aligned + MAPPING_SIZE;
+    if (base + length > tail) {
+        ::munmap(tail, (base + length) - tail);
+    }
+#ifdef MADV_HUGEPAGE
+    ::madvise(aligned, MAPPING_SIZE, MADV_HUGEPAGE);
+#endif
+#ifdef SYS_mbind
+    if (node >= 0 && node < 64) {
+        // MPOL_PREFERRED keeps the allocation working when the node is full or absent
+        constexpr int MPOL_PREFERRED_MODE = 1;
+        unsigned long nodemask = 1UL << node;
+        ::syscall(SYS_mbind, aligned, MAPPING_SIZE, MPOL_PREFERRED_MODE, &nodemask, 64UL, 0U);
+    }
+#endif
+    bump = aligned;
+    bump_end = aligned + MAPPING_SIZE;
+}
+
+template <typename T>
+T* ChunkSlab<T>::allocate() {
+    T* chunk;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (!free_chunks.empty()) {
+            chunk = free_chunks.back();
+            free_chunks.pop_back();
+        } else {
+            if (static_cast<size_t>(bump_end - bump) < CHUNK_BYTES) {
+                map_slab();
+            }
+            chunk = reinterpret_cast<T*>(bump);
+            bump += CHUNK_BYTES;
+        }
+    }
+    try {
+        std::uninitialized_value_construct_n(chunk, CHUNK_SIZE);
+    } catch (...) {
+        std::lock_guard<std::mutex> guard(lock);
+        free_chunks.push_back(chunk);
+        throw;
+    }
+    return chunk;
+}
+
+template <typename T>
+void ChunkSlab<T>::deallocate(T* chunk) noexcept {
+    std::destroy_n(chunk, CHUNK_SIZE);
+    std::lock_guard<std::mutex> guard(lock);
+    free_chunks.push_back(chunk);
+}
+
+template <typename T>
+void use_slab_allocation(Deque<T>& deque, int numa_node) {
+    deque.use_chunk_pool(&ChunkSlab<T>::instance(numa_node));
+}
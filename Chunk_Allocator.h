@@ -0,0 +1,48 @@
+#ifndef CHUNK_ALLOCATOR_H
+#define CHUNK_ALLOCATOR_H
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+#include "Chunk_Pool.h"
+#include "Deque.h"
+
+// Process-wide pool that carves fixed-size chunks out of 2 MB slabs.
+// Slabs are mapped huge-page aligned, advised for transparent huge pages and
+// optionally bound to a NUMA node. They stay mapped for the life of the process.
+template <typename T>
+class ChunkSlab : public ChunkPool<T> {
+    public:
+        using ChunkPool<T>::CHUNK_SIZE;
+        static constexpr size_t SLAB_SIZE = 2 * 1024 * 1024; // One huge page
+
+        // Pool for the given NUMA node, -1 for no binding
+        static ChunkSlab& instance(int numa_node = -1);
+
+        T* allocate() override;                      // Value-initialized chunk of CHUNK_SIZE elements
+        void deallocate(T* chunk) noexcept override; // Destroys the elements and recycles the chunk
+
+        ChunkSlab(const ChunkSlab&) = delete;
+        ChunkSlab& operator=(const ChunkSlab&) = delete;
+
+    private:
+        explicit ChunkSlab(int numa_node);
+
+        void map_slab();
+
+        static constexpr size_t CHUNK_BYTES = (sizeof(T) * CHUNK_SIZE + 63) / 64 * 64; // Cache-line stride
+        static constexpr size_t MAPPING_SIZE = (CHUNK_BYTES + SLAB_SIZE - 1) / SLAB_SIZE * SLAB_SIZE;
+
+        int node;
+        std::mutex lock;
+        std::vector<T*> free_chunks;
+        char* bump;        // Next uncarved byte of the current slab
+        char* bump_end;
+};
+
+// Carve the deque's future chunks from huge-page slabs, optionally placed on a NUMA node
+template <typename T>
+void use_slab_allocation(Deque<T>& deque, int numa_node = -1);
+
+#include "Chunk_Allocator.cpp"
+#endif //CHUNK_ALLOCATOR_H
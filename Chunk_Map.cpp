@@ -0,0 +1,188 @@
+#include "Chunk_Map.h"
+
+template <typename T>
+ChunkMap<T>::ChunkMap() : slots{}, head{0} {}
+
+template <typename T>
+ChunkMap<T>::ChunkMap(ChunkMap&& other) noexcept : slots(std::move(other.slots)), head{other.head} {
+    other.slots.clear();
+    other.head = 0;
+}
+
+template <typename T>
+ChunkMap<T>& ChunkMap<T>::operator=(ChunkMap&& other) noexcept {
+    if (this != &other) {
+        slots = std::move(other.slots);
+        head = other.head;
+        other.slots.clear();
+        other.head = 0;
+    }
+    return *this;
+}
+
+template <typename T>
+Chunk<T>& ChunkMap<T>::operator[](size_t index) {
+    return slots[head + index];
+}
+
+template <typename T>
+const Chunk<T>& ChunkMap<T>::operator[](size_t index) const {
+    return slots[head + index];
+}
+
+template <typename T>
+Chunk<T>& ChunkMap<T>::front() {
+    return slots[head];
+}
+
+template <typename T>
+const Chunk<T>& ChunkMap<T>::front() const {
+    return slots[head];
+}
+
+template <typename T>
+Chunk<T>& ChunkMap<T>::back() {
+    return slots.back();
+}
+
+template <typename T>
+const Chunk<T>& ChunkMap<T>::back() const {
+    return slots.back();
+}
+
+template <typename T>
+Chunk<T>* ChunkMap<T>::data() {
+    return slots.data() + head;
+}
+
+template <typename T>
+const Chunk<T>* ChunkMap<T>::data() const {
+    return slots.data() + head;
+}
+
+template <typename T>
+typename ChunkMap<T>::iterator ChunkMap<T>::begin() {
+    return data();
+}
+
+template <typename T>
+typename ChunkMap<T>::iterator ChunkMap<T>::end() {
+    return slots.data() + slots.size();
+}
+
+template <typename T>
+typename ChunkMap<T>::const_iterator ChunkMap<T>::begin() const {
+    return data();
+}
+
+template <typename T>
+typename ChunkMap<T>::const_iterator ChunkMap<T>::end() const {
+    return slots.data() + slots.size();
+}
+
+template <typename T>
+size_t ChunkMap<T>::size() const {
+    return slots.size() - head;
+}
+
+template <typename T>
+bool ChunkMap<T>::empty() const {
+    return slots.size() == head;
+}
+
+template <typename T>
+size_t ChunkMap<T>::front_capacity() const {
+    return head;
+}
+
+// Slide the entries left or right inside slots; the slots they leave stay empty
+template <typename T>
+void ChunkMap<T>::recenter(size_t front_room) {
+    size_t count = size();
+    if (front_room < head) {
+        std::move(slots.begin() + head, slots.end(), slots.begin() + front_room);
+        slots.resize(front_room + count);
+    } else if (front_room > head) {
+        slots.resize(front_room + count);
+        std::move_backward(slots.begin() + head, slots.begin() + head + count, slots.end());
+    }
+    head = front_room;
+}
+
+template <typename T>
+void ChunkMap<T>::reserve(size_t n) {
+    slots.reserve(head + n);
+}
+
+template <typename T>
+void ChunkMap<T>::reserve_front(size_t n) {
+    if (n > head) {
+        slots.reserve(n + slots.capacity() - head);
+        recenter(n);
+    }
+}
+
+// Drop the free front slots too
+template <typename T>
+void ChunkMap<T>::shrink_to_fit() {
+    recenter(0);
+    slots.shrink_to_fit();
+}
+
+// Before the vector has to grow, reuse the front slots if more than half of the map
+// is free there, as it is in a deque used as a FIFO queue
+template <typename T>
+void ChunkMap<T>::push_back(Chunk<T>&& chunk) {
+    if (slots.size() == slots.capacity() && head > size()) {
+        recenter(size() / 2);
+    }
+    slots.push_back(std::move(chunk));
+}
+
+// Out of front slots, grow the front room to the number of entries, so a run of
+// push_front calls moves every entry O(1) times on average
+template <typename T>
+void ChunkMap<T>::push_front(Chunk<T>&& chunk) {
+    if (head == 0) {
+        recenter(std::max<size_t>(size(), 1));
+    }
+    slots[--head] = std::move(chunk);
+}
+
+template <typename T>
+typename ChunkMap<T>::iterator ChunkMap<T>::insert(const_iterator pos, Chunk<T>&& chunk) {
+    size_t index = pos - begin();
+    if (index == 0) {
+        push_front(std::move(chunk));
+        return begin();
+    }
+    slots.insert(slots.begin() + head + index, std::move(chunk));
+    return begin() + index;
+}
+
+// Erasing a prefix only frees the entries and moves head past them
+template <typename T>
+typename ChunkMap<T>::iterator ChunkMap<T>::erase(const_iterator first, const_iterator last) {
+    size_t index = first - begin();
+    size_t count = last - first;
+    if (index == 0) {
+        for (size_t i = 0; i < count; ++i) {
+            slots[head + i].reset();
+        }
+        head += count;
+        return begin();
+    }
+    slots.erase(slots.begin() + head + index, slots.begin() + head + index + count);
+    return begin() + index;
+}
+
+template <typename T>
+void ChunkMap<T>::resize(size_t n) {
+    slots.resize(head + n);
+}
+
+// Keeps the front room for the next chunks
+template <typename T>
+void ChunkMap<T>::clear() {
+    slots.resize(head);
+}
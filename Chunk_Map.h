@@ -0,0 +1,63 @@
+#ifndef CHUNK_MAP_H
+#define CHUNK_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "Chunk_Pool.h"
+
+// The chunk pointers of a Deque, in order. Like the map of std::deque it keeps free
+// slots before the first entry as well as after the last, so chunks enter and leave at
+// either end without moving the others. Otherwise it behaves like a vector of chunks.
+template <typename T>
+class ChunkMap {
+    private:
+        std::vector<Chunk<T>> slots; // Entries live in slots[head, slots.size())
+        size_t head;                 // Free slots before the first entry
+
+        void recenter(size_t front_room); // Move the entries so front_room free slots precede them
+
+    public:
+        using value_type = Chunk<T>;
+        using iterator = Chunk<T>*;
+        using const_iterator = const Chunk<T>*;
+
+        ChunkMap();
+        ChunkMap(ChunkMap&& other) noexcept;
+        ChunkMap& operator=(ChunkMap&& other) noexcept;
+
+        // Element access
+        Chunk<T>& operator[](size_t index);
+        const Chunk<T>& operator[](size_t index) const;
+        Chunk<T>& front();
+        const Chunk<T>& front() const;
+        Chunk<T>& back();
+        const Chunk<T>& back() const;
+        Chunk<T>* data();
+        const Chunk<T>* data() const;
+
+        // Iterators
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        // Capacity
+        size_t size() const;
+        bool empty() const;
+        size_t front_capacity() const; // Entries push_front can add without moving any
+        void reserve(size_t n);       // Room for n entries from the first one on
+        void reserve_front(size_t n); // Room for n entries before the first one
+        void shrink_to_fit();
+
+        // Modifiers
+        void push_back(Chunk<T>&& chunk);
+        void push_front(Chunk<T>&& chunk);
+        iterator insert(const_iterator pos, Chunk<T>&& chunk);
+        iterator erase(const_iterator first, const_iterator last);
+        void resize(size_t n);
+        void clear();
+};
+
+#include "Chunk_Map.cpp"
+#endif //CHUNK_MAP_H
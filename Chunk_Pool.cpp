@@ -0,0 +1,19 @@
+#include "Chunk_Pool.h"
+
+template <typename T>
+void ChunkDeleter<T>::operator()(T* chunk) const noexcept {
+    if (pool) {
+        pool->deallocate(chunk);
+    } else {
+        delete[] chunk;
+    }
+}
+
+// Take ownership of chunk; release frees it with the deleter it was created with
+template <typename T>
+RetiredChunk retire_chunk(Chunk<T>&& chunk) {
+    ChunkPool<T>* pool = chunk.get_deleter().pool;
+    return RetiredChunk{chunk.release(), pool, [](void* data, void* source) {
+        ChunkDeleter<T>{static_cast<ChunkPool<T>*>(source)}(static_cast<T*>(data));
+    }};
+}
@@ -0,0 +1,53 @@
+#ifndef CHUNK_POOL_H
+#define CHUNK_POOL_H
+
+#include <cstddef>
+#include <memory>
+
+// Source of fixed-size deque chunks. A pool hands out value-initialized arrays
+// of CHUNK_SIZE elements and takes them back through deallocate.
+template <typename T>
+class ChunkPool {
+    public:
+        static constexpr size_t CHUNK_SIZE = 128; // Must match Deque::CHUNK_SIZE
+
+        virtual ~ChunkPool() = default;
+
+        virtual T* allocate() = 0;                      // Value-initialized chunk of CHUNK_SIZE elements
+        virtual void deallocate(T* chunk) noexcept = 0; // Destroys the elements and takes the chunk back
+};
+
+// Deleter for deque chunks: chunks without a pool came from new[]
+template <typename T>
+struct ChunkDeleter {
+    ChunkPool<T>* pool = nullptr;
+
+    void operator()(T* chunk) const noexcept;
+};
+
+template <typename T>
+using Chunk = std::unique_ptr<T[], ChunkDeleter<T>>;
+
+// How a Deque disposes of the elements it removes
+enum class DestructionPolicy {
+    Immediate,  // Reset each popped element right away
+    Deferred,   // Leave popped elements until their chunk is released
+    Background  // Like Deferred, but released chunks are freed on a reclaimer thread
+                // (needs Chunk_Reclaimer.h; without it they are freed inline)
+};
+
+// A released chunk with its element type erased, so another thread can free it
+struct RetiredChunk {
+    void* chunk;
+    void* pool;
+    void (*release)(void* chunk, void* pool);
+};
+
+template <typename T>
+RetiredChunk retire_chunk(Chunk<T>&& chunk);
+
+// Where Background deques send released chunks; installed by Chunk_Reclaimer.h
+inline void (*background_retire)(RetiredChunk retired) = nullptr;
+
+#include "Chunk_Pool.cpp"
+#endif //CHUNK_POOL_H
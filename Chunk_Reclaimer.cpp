@@ -0,0 +1,62 @@
+#include "Chunk_Reclaimer.h"
+
+inline ChunkReclaimer& ChunkReclaimer::instance() {
+    static ChunkReclaimer* reclaimer = new ChunkReclaimer();
+    return *reclaimer;
+}
+
+inline ChunkReclaimer::ChunkReclaimer() : in_flight{0} {
+    worker = std::thread([this] { run(); });
+    worker.detach();
+}
+
+template <typename T>
+void ChunkReclaimer::retire(Chunk<T>&& chunk) {
+    if (chunk) {
+        retire(retire_chunk(std::move(chunk)));
+    }
+}
+
+inline void ChunkReclaimer::retire(RetiredChunk retired) {
+    bool was_idle;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        was_idle = pending.empty();
+        pending.push_back(retired);
+    }
+    if (was_idle) {
+        work_ready.notify_one();
+    }
+}
+
+inline void ChunkReclaimer::flush() {
+    std::unique_lock<std::mutex> guard(lock);
+    work_done.wait(guard, [this] { return pending.empty() && in_flight == 0; });
+}
+
+// Swap out the whole pending batch and free it without holding the lock
+inline void ChunkReclaimer::run() {
+    std::vector<RetiredChunk> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            in_flight = 0;
+            if (pending.empty()) {
+                work_done.notify_all();
+            }
+            work_ready.wait(guard, [this] { return !pending.empty(); });
+            batch.swap(pending);
+            in_flight = batch.size();
+        }
+        for (const RetiredChunk& retired : batch) {
+            retired.release(retired.chunk, retired.pool);
+        }
+        batch.clear();
+    }
+}
+
+// Route Background deques to the reclaimer as soon as this header is part of the program
+inline const bool chunk_reclaimer_installed = [] {
+    background_retire = [](RetiredChunk retired) { ChunkReclaimer::instance().retire(retired); };
+    return true;
+}();
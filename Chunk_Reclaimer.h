@@ -0,0 +1,40 @@
+#ifndef CHUNK_RECLAIMER_H
+#define CHUNK_RECLAIMER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Chunk_Pool.h"
+
+// Background thread that frees retired deque chunks off the caller's critical path.
+// The singleton is never destroyed, so deques may retire chunks during shutdown.
+// Including this header is what lets DestructionPolicy::Background hand chunks off.
+class ChunkReclaimer {
+    public:
+        static ChunkReclaimer& instance();
+
+        template <typename T>
+        void retire(Chunk<T>&& chunk); // Take ownership and free the chunk later
+        void retire(RetiredChunk retired); // Same, for a chunk whose type is already erased
+        void flush();                  // Block until every retired chunk has been freed
+
+        ChunkReclaimer(const ChunkReclaimer&) = delete;
+        ChunkReclaimer& operator=(const ChunkReclaimer&) = delete;
+
+    private:
+        ChunkReclaimer();
+
+        void run();
+
+        std::mutex lock;
+        std::condition_variable work_ready;
+        std::condition_variable work_done;
+        std::vector<RetiredChunk> pending;
+        size_t in_flight;  // Chunks taken by the worker but not yet freed
+        std::thread worker;
+};
+
+#include "Chunk_Reclaimer.cpp"
+#endif //CHUNK_RECLAIMER_H
@@ -0,0 +1,446 @@
+#include "Columnar_Deque.h"
+#include <cassert>
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+ColumnarIterator<IsConst, IsReverse, Fields...>::ColumnarIterator() : owner{nullptr}, index{0} {}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+ColumnarIterator<IsConst, IsReverse, Fields...>::ColumnarIterator(Ownerpointer _owner, difference_type _index)
+    : owner{_owner}, index{_index} {}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+ColumnarIterator<IsConst, IsReverse, Fields...>
+ColumnarIterator<IsConst, IsReverse, Fields...>::operator+(difference_type n) const {
+    ColumnarIterator temp = *this;
+    temp += n;
+    return temp;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+ColumnarIterator<IsConst, IsReverse, Fields...>
+ColumnarIterator<IsConst, IsReverse, Fields...>::operator-(difference_type n) const {
+    ColumnarIterator temp = *this;
+    temp -= n;
+    return temp;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+typename ColumnarIterator<IsConst, IsReverse, Fields...>::difference_type
+ColumnarIterator<IsConst, IsReverse, Fields...>::operator-(const ColumnarIterator& other) const {
+    return IsReverse ? other.index - index : index - other.index;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+ColumnarIterator<IsConst, IsReverse, Fields...>& ColumnarIterator<IsConst, IsReverse, Fields...>::operator++() {
+    return *this += 1;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+ColumnarIterator<IsConst, IsReverse, Fields...> ColumnarIterator<IsConst, IsReverse, Fields...>::operator++(int) {
+    ColumnarIterator tmp = *this;
+    *this += 1;
+    return tmp;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+ColumnarIterator<IsConst, IsReverse, Fields...>& ColumnarIterator<IsConst, IsReverse, Fields...>::operator--() {
+    return *this -= 1;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+ColumnarIterator<IsConst, IsReverse, Fields...> ColumnarIterator<IsConst, IsReverse, Fields...>::operator--(int) {
+    ColumnarIterator tmp = *this;
+    *this -= 1;
+    return tmp;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+ColumnarIterator<IsConst, IsReverse, Fields...>&
+ColumnarIterator<IsConst, IsReverse, Fields...>::operator+=(difference_type n) {
+    if constexpr (IsReverse) {
+        index -= n;
+    } else {
+        index += n;
+    }
+    return *this;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+ColumnarIterator<IsConst, IsReverse, Fields...>&
+ColumnarIterator<IsConst, IsReverse, Fields...>::operator-=(difference_type n) {
+    return *this += -n;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+typename ColumnarIterator<IsConst, IsReverse, Fields...>::reference
+ColumnarIterator<IsConst, IsReverse, Fields...>::operator*() const {
+    return (*owner)[static_cast<size_t>(index)];
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+typename ColumnarIterator<IsConst, IsReverse, Fields...>::reference
+ColumnarIterator<IsConst, IsReverse, Fields...>::operator[](difference_type n) const {
+    return *(*this + n);
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+bool ColumnarIterator<IsConst, IsReverse, Fields...>::operator>(const ColumnarIterator& other) const {
+    return *this - other > 0;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+bool ColumnarIterator<IsConst, IsReverse, Fields...>::operator<(const ColumnarIterator& other) const {
+    return *this - other < 0;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+bool ColumnarIterator<IsConst, IsReverse, Fields...>::operator>=(const ColumnarIterator& other) const {
+    return *this - other >= 0;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+bool ColumnarIterator<IsConst, IsReverse, Fields...>::operator<=(const ColumnarIterator& other) const {
+    return *this - other <= 0;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+bool ColumnarIterator<IsConst, IsReverse, Fields...>::operator==(const ColumnarIterator& other) const {
+    return index == other.index;
+}
+
+template <bool IsConst, bool IsReverse, typename... Fields>
+bool ColumnarIterator<IsConst, IsReverse, Fields...>::operator!=(const ColumnarIterator& other) const {
+    return index != other.index;
+}
+
+template <typename... Fields>
+ColumnarDeque<Fields...>::ColumnarDeque() : chunk_map{}, head{0}, num_elements{0} {}
+
+// Copy constructor: deep copy every column of every chunk
+template <typename... Fields>
+ColumnarDeque<Fields...>::ColumnarDeque(const ColumnarDeque& other)
+    : chunk_map{}, head{other.head}, num_elements{other.num_elements} {
+    chunk_map.reserve(other.chunk_map.size());
+    for (const ChunkColumns& source : other.chunk_map) {
+        chunk_map.push_back(allocate_chunk());
+        std::apply([&](auto&... dest) {
+            std::apply([&](const auto&... src) {
+                (std::copy(src.get(), src.get() + CHUNK_SIZE, dest.get()), ...);
+            }, source);
+        }, chunk_map.back());
+    }
+}
+
+template <typename... Fields>
+ColumnarDeque<Fields...>::ColumnarDeque(ColumnarDeque&& other) noexcept
+    : chunk_map{std::move(other.chunk_map)}, head{other.head}, num_elements{other.num_elements} {
+    other.reset();
+}
+
+template <typename... Fields>
+ColumnarDeque<Fields...>& ColumnarDeque<Fields...>::operator=(const ColumnarDeque& other) {
+    if (this != &other) {
+        ColumnarDeque copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+template <typename... Fields>
+ColumnarDeque<Fields...>& ColumnarDeque<Fields...>::operator=(ColumnarDeque&& other) noexcept {
+    if (this != &other) {
+        chunk_map = std::move(other.chunk_map);
+        head = other.head;
+        num_elements = other.num_elements;
+        other.reset();
+    }
+    return *this;
+}
+
+// Allocate one array per field
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::ChunkColumns ColumnarDeque<Fields...>::allocate_chunk() {
+    return ChunkColumns(Chunk<Fields>(new Fields[CHUNK_SIZE]())...);
+}
+
+template <typename... Fields>
+template <size_t... I>
+std::tuple<Fields&...> ColumnarDeque<Fields...>::row(size_t pos, std::index_sequence<I...>) {
+    size_t index = head + pos;
+    ChunkColumns& columns = chunk_map[index / CHUNK_SIZE];
+    return std::tuple<Fields&...>(std::get<I>(columns)[index % CHUNK_SIZE]...);
+}
+
+template <typename... Fields>
+template <size_t... I>
+std::tuple<const Fields&...> ColumnarDeque<Fields...>::row(size_t pos, std::index_sequence<I...>) const {
+    size_t index = head + pos;
+    const ChunkColumns& columns = chunk_map[index / CHUNK_SIZE];
+    return std::tuple<const Fields&...>(std::get<I>(columns)[index % CHUNK_SIZE]...);
+}
+
+template <typename... Fields>
+template <size_t... I>
+void ColumnarDeque<Fields...>::store(size_t pos, std::index_sequence<I...>, const Fields&... vals) {
+    size_t index = head + pos;
+    ChunkColumns& columns = chunk_map[index / CHUNK_SIZE];
+    ((std::get<I>(columns)[index % CHUNK_SIZE] = vals), ...);
+}
+
+// Only columns whose type owns resources need resetting; trivial fields are left as they are
+template <typename... Fields>
+void ColumnarDeque<Fields...>::release_slot(size_t pos) {
+    size_t index = head + pos;
+    std::apply([&](auto&... columns) {
+        ([&](auto& column) {
+            using Field = std::remove_reference_t<decltype(column[0])>;
+            if constexpr (!std::is_trivially_destructible_v<Field>) {
+                column[index % CHUNK_SIZE] = Field{};
+            }
+        }(columns), ...);
+    }, chunk_map[index / CHUNK_SIZE]);
+}
+
+template <typename... Fields>
+void ColumnarDeque<Fields...>::reset() {
+    chunk_map.clear();
+    head = 0;
+    num_elements = 0;
+}
+
+// Add an element to the back of the deque
+template <typename... Fields>
+void ColumnarDeque<Fields...>::push_back(const Fields&... vals) {
+    if (head + num_elements == chunk_map.size() * CHUNK_SIZE) {
+        chunk_map.push_back(allocate_chunk());
+    }
+    store(num_elements, std::index_sequence_for<Fields...>{}, vals...);
+    ++num_elements;
+}
+
+// Add an element to the front of the deque
+template <typename... Fields>
+void ColumnarDeque<Fields...>::push_front(const Fields&... vals) {
+    if (head == 0) {
+        chunk_map.insert(chunk_map.begin(), allocate_chunk());
+        head = CHUNK_SIZE;
+    }
+    --head;
+    ++num_elements;
+    store(0, std::index_sequence_for<Fields...>{}, vals...);
+}
+
+// Remove an element from the back, releasing the tail chunk once it is empty
+template <typename... Fields>
+void ColumnarDeque<Fields...>::pop_back() {
+    if (num_elements == 0) {
+        throw std::out_of_range("Cannot pop from an empty deque");
+    }
+    release_slot(num_elements - 1);
+    --num_elements;
+    if (num_elements == 0) {
+        reset();
+        return;
+    }
+    if ((head + num_elements) % CHUNK_SIZE == 0) {
+        chunk_map.pop_back();
+    }
+}
+
+// Remove an element from the front, releasing the head chunk once it is empty
+template <typename... Fields>
+void ColumnarDeque<Fields...>::pop_front() {
+    if (num_elements == 0) {
+        throw std::out_of_range("Cannot pop from an empty deque");
+    }
+    release_slot(0);
+    --num_elements;
+    if (num_elements == 0) {
+        reset();
+        return;
+    }
+    if (++head == CHUNK_SIZE) {
+        chunk_map.erase(chunk_map.begin());
+        head = 0;
+    }
+}
+
+template <typename... Fields>
+void ColumnarDeque<Fields...>::clear() {
+    reset();
+}
+
+// Access element at pos with bounds checking
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::reference ColumnarDeque<Fields...>::at(size_t pos) {
+    if (pos >= num_elements) {
+        throw std::out_of_range("Deque index out of range");
+    }
+    return row(pos, std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::const_reference ColumnarDeque<Fields...>::at(size_t pos) const {
+    if (pos >= num_elements) {
+        throw std::out_of_range("Deque index out of range");
+    }
+    return row(pos, std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::reference ColumnarDeque<Fields...>::front() {
+    if (num_elements == 0) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return row(0, std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::const_reference ColumnarDeque<Fields...>::front() const {
+    if (num_elements == 0) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return row(0, std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::reference ColumnarDeque<Fields...>::back() {
+    if (num_elements == 0) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return row(num_elements - 1, std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::const_reference ColumnarDeque<Fields...>::back() const {
+    if (num_elements == 0) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return row(num_elements - 1, std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::reference ColumnarDeque<Fields...>::operator[](size_t pos) {
+    assert(pos < num_elements && "Deque index out of range");
+    return row(pos, std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::const_reference ColumnarDeque<Fields...>::operator[](size_t pos) const {
+    assert(pos < num_elements && "Deque index out of range");
+    return row(pos, std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+template <size_t I>
+typename ColumnarDeque<Fields...>::template field_type<I>& ColumnarDeque<Fields...>::get(size_t pos) {
+    assert(pos < num_elements && "Deque index out of range");
+    size_t index = head + pos;
+    return std::get<I>(chunk_map[index / CHUNK_SIZE])[index % CHUNK_SIZE];
+}
+
+template <typename... Fields>
+template <size_t I>
+const typename ColumnarDeque<Fields...>::template field_type<I>& ColumnarDeque<Fields...>::get(size_t pos) const {
+    assert(pos < num_elements && "Deque index out of range");
+    size_t index = head + pos;
+    return std::get<I>(chunk_map[index / CHUNK_SIZE])[index % CHUNK_SIZE];
+}
+
+template <typename... Fields>
+template <size_t I>
+std::vector<std::span<const typename ColumnarDeque<Fields...>::template field_type<I>>>
+ColumnarDeque<Fields...>::column_segments(size_t pos, size_t count) const {
+    if (pos > num_elements) {
+        throw std::out_of_range("Deque index out of range");
+    }
+    count = std::min(count, num_elements - pos);
+    std::vector<std::span<const field_type<I>>> spans;
+    spans.reserve(count / CHUNK_SIZE + 2);
+    size_t index = head + pos;
+    while (count > 0) {
+        size_t slot = index % CHUNK_SIZE;
+        size_t length = std::min(count, CHUNK_SIZE - slot);
+        spans.emplace_back(std::get<I>(chunk_map[index / CHUNK_SIZE]).get() + slot, length);
+        index += length;
+        count -= length;
+    }
+    return spans;
+}
+
+// Walk column I a chunk at a time, so f sees contiguous arrays it can vectorize
+template <typename... Fields>
+template <size_t I, typename F>
+void ColumnarDeque<Fields...>::for_each_column_segment(F&& f) const {
+    size_t index = head;
+    size_t count = num_elements;
+    while (count > 0) {
+        size_t slot = index % CHUNK_SIZE;
+        size_t length = std::min(count, CHUNK_SIZE - slot);
+        f(static_cast<const field_type<I>*>(std::get<I>(chunk_map[index / CHUNK_SIZE]).get() + slot), length);
+        index += length;
+        count -= length;
+    }
+}
+
+// Iterators
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::iterator ColumnarDeque<Fields...>::begin() {
+    return iterator(this, 0);
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::const_iterator ColumnarDeque<Fields...>::begin() const {
+    return const_iterator(this, 0);
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::const_iterator ColumnarDeque<Fields...>::cbegin() const {
+    return const_iterator(this, 0);
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::reverse_iterator ColumnarDeque<Fields...>::rbegin() {
+    return reverse_iterator(this, static_cast<std::ptrdiff_t>(num_elements) - 1);
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::const_reverse_iterator ColumnarDeque<Fields...>::crbegin() const {
+    return const_reverse_iterator(this, static_cast<std::ptrdiff_t>(num_elements) - 1);
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::iterator ColumnarDeque<Fields...>::end() {
+    return iterator(this, static_cast<std::ptrdiff_t>(num_elements));
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::const_iterator ColumnarDeque<Fields...>::end() const {
+    return const_iterator(this, static_cast<std::ptrdiff_t>(num_elements));
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::const_iterator ColumnarDeque<Fields...>::cend() const {
+    return const_iterator(this, static_cast<std::ptrdiff_t>(num_elements));
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::reverse_iterator ColumnarDeque<Fields...>::rend() {
+    return reverse_iterator(this, -1);
+}
+
+template <typename... Fields>
+typename ColumnarDeque<Fields...>::const_reverse_iterator ColumnarDeque<Fields...>::crend() const {
+    return const_reverse_iterator(this, -1);
+}
+
+// Capacity
+template <typename... Fields>
+bool ColumnarDeque<Fields...>::empty() const {
+    return num_elements == 0;
+}
+
+template <typename... Fields>
+size_t ColumnarDeque<Fields...>::size() const {
+    return num_elements;
+}
@@ -0,0 +1,153 @@
+#ifndef COLUMNAR_DEQUE_H
+#define COLUMNAR_DEQUE_H
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Chunk_Pool.h"
+
+template <typename... Fields>
+class ColumnarDeque;
+
+// Random-access iterator over a ColumnarDeque, dereferencing to a tuple of references
+template <bool IsConst, bool IsReverse, typename... Fields>
+class ColumnarIterator {
+    public:
+
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::tuple<Fields...>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<IsConst, std::tuple<const Fields&...>, std::tuple<Fields&...>>;
+    using const_reference = std::tuple<const Fields&...>;
+    using Ownerpointer = std::conditional_t<IsConst, const ColumnarDeque<Fields...>*, ColumnarDeque<Fields...>*>;
+
+    private:
+    friend ColumnarDeque<Fields...>;
+    Ownerpointer owner;
+    difference_type index; // Logical position from the front of the deque
+
+    ColumnarIterator(Ownerpointer _owner, difference_type _index);
+
+public:
+    ColumnarIterator();
+
+    ColumnarIterator operator+(difference_type n) const;
+    ColumnarIterator operator-(difference_type n) const;
+    difference_type operator-(const ColumnarIterator& other) const;
+
+    ColumnarIterator& operator++();
+    ColumnarIterator operator++(int);
+    ColumnarIterator& operator--();
+    ColumnarIterator operator--(int);
+
+    ColumnarIterator& operator+=(difference_type n);
+    ColumnarIterator& operator-=(difference_type n);
+
+    reference operator*() const;
+    reference operator[](difference_type n) const;
+
+    bool operator>(const ColumnarIterator& other) const;
+    bool operator<(const ColumnarIterator& other) const;
+    bool operator>=(const ColumnarIterator& other) const;
+    bool operator<=(const ColumnarIterator& other) const;
+    bool operator==(const ColumnarIterator& other) const;
+    bool operator!=(const ColumnarIterator& other) const;
+};
+
+// Structure-of-arrays deque: the same chunk map as Deque, but every chunk
+// holds one array per field, so a scan over one field reads only that column.
+template <typename... Fields>
+class ColumnarDeque {
+    private:
+        static_assert(sizeof...(Fields) > 0, "ColumnarDeque needs at least one field");
+        static constexpr size_t CHUNK_SIZE = 128;   // Fixed chunk size for memory allocation
+
+        using ChunkColumns = std::tuple<Chunk<Fields>...>;
+
+        std::vector<ChunkColumns> chunk_map; // One array per field for every chunk
+        size_t head;                         // Slot of the first element in chunk_map[0]
+        size_t num_elements;
+
+        static ChunkColumns allocate_chunk();
+        template <size_t... I>
+        std::tuple<Fields&...> row(size_t pos, std::index_sequence<I...>);
+        template <size_t... I>
+        std::tuple<const Fields&...> row(size_t pos, std::index_sequence<I...>) const;
+        template <size_t... I>
+        void store(size_t pos, std::index_sequence<I...>, const Fields&... vals);
+        void release_slot(size_t pos);       // Reset a removed row so its fields free what they own
+        void reset();
+
+    public:
+        using value_type = std::tuple<Fields...>;
+        using reference = std::tuple<Fields&...>;
+        using const_reference = std::tuple<const Fields&...>;
+        using iterator = ColumnarIterator<false, false, Fields...>;
+        using const_iterator = ColumnarIterator<true, false, Fields...>;
+        using reverse_iterator = ColumnarIterator<false, true, Fields...>;
+        using const_reverse_iterator = ColumnarIterator<true, true, Fields...>;
+        template <size_t I>
+        using field_type = std::tuple_element_t<I, value_type>;
+
+        // Constructors
+        ColumnarDeque();
+        ColumnarDeque(const ColumnarDeque& other);
+        ColumnarDeque(ColumnarDeque&& other) noexcept;
+
+        // Assignment operators
+        ColumnarDeque& operator=(const ColumnarDeque& other);
+        ColumnarDeque& operator=(ColumnarDeque&& other) noexcept;
+
+        // Modifiers
+        void push_back(const Fields&... vals);
+        void push_front(const Fields&... vals);
+        void pop_back();
+        void pop_front();
+        void clear();
+
+        // Element access
+        reference at(size_t pos);
+        const_reference at(size_t pos) const;
+        reference front();
+        const_reference front() const;
+        reference back();
+        const_reference back() const;
+        reference operator[](size_t pos);             // Unchecked, asserted in debug builds
+        const_reference operator[](size_t pos) const;
+        template <size_t I>
+        field_type<I>& get(size_t pos);               // Single column, unchecked
+        template <size_t I>
+        const field_type<I>& get(size_t pos) const;
+
+        // Column access: one contiguous span per chunk of [pos, pos + count) in column I
+        template <size_t I>
+        std::vector<std::span<const field_type<I>>> column_segments(size_t pos = 0,
+                            size_t count = std::numeric_limits<size_t>::max()) const;
+        template <size_t I, typename F>
+        void for_each_column_segment(F&& f) const;    // f(const field_type<I>* data, size_t count)
+
+        // Iterators
+        iterator begin();
+        const_iterator begin() const;
+        const_iterator cbegin() const;
+        reverse_iterator rbegin();
+        const_reverse_iterator crbegin() const;
+        iterator end();
+        const_iterator end() const;
+        const_iterator cend() const;
+        reverse_iterator rend();
+        const_reverse_iterator crend() const;
+
+        // Capacity
+        bool empty() const;
+        size_t size() const;
+};
+
+#include "Columnar_Deque.cpp"
+#endif //COLUMNAR_DEQUE_H
@@ -0,0 +1,280 @@
+#include "Compressed_Deque.h"
+#include <algorithm>
+#include <bit>
+
+template <typename T>
+CompressedDeque<T>::CompressedDeque() : head{}, head_size{0}, sealed{}, tail{}, tail_size{0} {}
+
+// Encode CHUNK_SIZE values: delta, zigzag, subtract the minimum, bit-pack
+template <typename T>
+typename CompressedDeque<T>::SealedChunk CompressedDeque<T>::seal(const T* values) {
+    uint64_t zigzag[CHUNK_SIZE - 1];
+    uint64_t low = std::numeric_limits<uint64_t>::max();
+    uint64_t high = 0;
+    for (size_t i = 1; i < CHUNK_SIZE; ++i) {
+        uint64_t delta = static_cast<uint64_t>(values[i]) - static_cast<uint64_t>(values[i - 1]);
+        uint64_t z = (delta << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(delta) >> 63);
+        zigzag[i - 1] = z;
+        low = std::min(low, z);
+        high = std::max(high, z);
+    }
+
+    SealedChunk chunk;
+    chunk.first = static_cast<uint64_t>(values[0]);
+    chunk.reference = low;
+    chunk.width = static_cast<uint8_t>(std::bit_width(high - low));
+    size_t bits = (CHUNK_SIZE - 1) * chunk.width;
+    chunk.words.assign((bits + 63) / 64 + 1, 0);
+    if (chunk.width == 0) {
+        return chunk;
+    }
+    for (size_t i = 0; i < CHUNK_SIZE - 1; ++i) {
+        uint64_t value = zigzag[i] - low;
+        size_t bit = i * chunk.width;
+        size_t word = bit >> 6;
+        size_t offset = bit & 63;
+        chunk.words[word] |= value << offset;
+        if (offset + chunk.width > 64) {
+            chunk.words[word + 1] |= value >> (64 - offset);
+        }
+    }
+    return chunk;
+}
+
+// Packed delta i, still zigzag-encoded and offset by the reference
+template <typename T>
+uint64_t CompressedDeque<T>::unpack(const SealedChunk& chunk, size_t index) {
+    if (chunk.width == 0) {
+        return 0;
+    }
+    uint64_t mask = chunk.width == 64 ? ~uint64_t{0} : (uint64_t{1} << chunk.width) - 1;
+    size_t bit = index * chunk.width;
+    size_t word = bit >> 6;
+    size_t offset = bit & 63;
+    // The padding word makes words[word + 1] always readable; the split shift
+    // keeps offset 0 well defined
+    uint64_t value = (chunk.words[word] >> offset) | ((chunk.words[word + 1] << 1) << (63 - offset));
+    return value & mask;
+}
+
+// Decode the first count values. The unpack loop has no loop-carried dependency
+// so the compiler can vectorize it; only the prefix sum is serial.
+template <typename T>
+void CompressedDeque<T>::unseal(const SealedChunk& chunk, T* out, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    uint64_t deltas[CHUNK_SIZE - 1];
+    size_t packed = count - 1;
+    if (chunk.width == 0) {
+        std::fill(deltas, deltas + packed, chunk.reference);
+    } else {
+        uint64_t mask = chunk.width == 64 ? ~uint64_t{0} : (uint64_t{1} << chunk.width) - 1;
+        const uint64_t* words = chunk.words.data();
+        for (size_t i = 0; i < packed; ++i) {
+            size_t bit = i * chunk.width;
+            size_t offset = bit & 63;
+            uint64_t value = (words[bit >> 6] >> offset) | ((words[(bit >> 6) + 1] << 1) << (63 - offset));
+            deltas[i] = (value & mask) + chunk.reference;
+        }
+    }
+    for (size_t i = 0; i < packed; ++i) {
+        uint64_t z = deltas[i];
+        deltas[i] = (z >> 1) ^ (~(z & 1) + 1);
+    }
+    uint64_t value = chunk.first;
+    out[0] = static_cast<T>(value);
+    for (size_t i = 1; i < count; ++i) {
+        value += deltas[i - 1];
+        out[i] = static_cast<T>(value);
+    }
+}
+
+template <typename T>
+void CompressedDeque<T>::push_back(T val) {
+    if (tail_size == CHUNK_SIZE) {
+        sealed.emplace_back(seal(tail.data()));
+        tail_size = 0;
+    }
+    tail[tail_size++] = val;
+}
+
+template <typename T>
+void CompressedDeque<T>::push_front(T val) {
+    if (head_size == CHUNK_SIZE) {
+        sealed.push_front(seal(head.data()));
+        head_size = 0;
+    }
+    ++head_size;
+    head[CHUNK_SIZE - head_size] = val;
+}
+
+// Take the back from the tail, refilling it from the last sealed chunk or the head
+template <typename T>
+void CompressedDeque<T>::pop_back() {
+    if (tail_size == 0) {
+        if (!sealed.empty()) {
+            unseal(sealed.back(), tail.data());
+            sealed.pop_back();
+            tail_size = CHUNK_SIZE;
+        } else if (head_size > 0) {
+            std::copy(head.end() - head_size, head.end(), tail.begin());
+            tail_size = head_size;
+            head_size = 0;
+        } else {
+            throw std::out_of_range("Cannot pop from an empty deque");
+        }
+    }
+    --tail_size;
+}
+
+// Take the front from the head, refilling it from the first sealed chunk or the tail
+template <typename T>
+void CompressedDeque<T>::pop_front() {
+    if (head_size == 0) {
+        if (!sealed.empty()) {
+            unseal(sealed.front(), head.data());
+            sealed.pop_front();
+            head_size = CHUNK_SIZE;
+        } else if (tail_size > 0) {
+            std::copy(tail.begin(), tail.begin() + tail_size, head.end() - tail_size);
+            head_size = tail_size;
+            tail_size = 0;
+        } else {
+            throw std::out_of_range("Cannot pop from an empty deque");
+        }
+    }
+    --head_size;
+}
+
+template <typename T>
+void CompressedDeque<T>::clear() {
+    sealed.clear();
+    head_size = 0;
+    tail_size = 0;
+}
+
+template <typename T>
+T CompressedDeque<T>::at(size_t pos) const {
+    if (pos >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return (*this)[pos];
+}
+
+// Unchecked; a sealed element costs decoding its chunk up to pos
+template <typename T>
+T CompressedDeque<T>::operator[](size_t pos) const {
+    if (pos < head_size) {
+        return head[CHUNK_SIZE - head_size + pos];
+    }
+    pos -= head_size;
+    size_t sealed_elements = sealed.size() * CHUNK_SIZE;
+    if (pos >= sealed_elements) {
+        return tail[pos - sealed_elements];
+    }
+    const SealedChunk& chunk = sealed[pos / CHUNK_SIZE];
+    size_t index = pos % CHUNK_SIZE;
+    uint64_t value = chunk.first;
+    for (size_t i = 0; i < index; ++i) {
+        uint64_t z = unpack(chunk, i) + chunk.reference;
+        value += (z >> 1) ^ (~(z & 1) + 1);
+    }
+    return static_cast<T>(value);
+}
+
+template <typename T>
+T CompressedDeque<T>::front() const {
+    if (empty()) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return (*this)[0];
+}
+
+template <typename T>
+T CompressedDeque<T>::back() const {
+    if (empty()) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return (*this)[size() - 1];
+}
+
+// Copy [pos, pos + n) into dest, decoding each touched sealed chunk once
+template <typename T>
+void CompressedDeque<T>::copy_out(size_t pos, T* dest, size_t n) const {
+    if (pos > size() || n > size() - pos) {
+        throw std::out_of_range("Range out of bounds");
+    }
+    size_t index = 0;
+    for_each_segment([&](const T* data, size_t count) {
+        size_t begin = std::max(pos, index);
+        size_t end = std::min(pos + n, index + count);
+        if (begin < end) {
+            std::copy(data + (begin - index), data + (end - index), dest + (begin - pos));
+        }
+        index += count;
+    });
+}
+
+template <typename T>
+template <typename F>
+void CompressedDeque<T>::for_each_segment(F&& f) const {
+    if (head_size > 0) {
+        f(static_cast<const T*>(head.data() + CHUNK_SIZE - head_size), head_size);
+    }
+    T buffer[CHUNK_SIZE];
+    for (size_t i = 0; i < sealed.size(); ++i) {
+        unseal(sealed[i], buffer);
+        f(static_cast<const T*>(buffer), CHUNK_SIZE);
+    }
+    if (tail_size > 0) {
+        f(static_cast<const T*>(tail.data()), tail_size);
+    }
+}
+
+template <typename T>
+template <typename F>
+void CompressedDeque<T>::for_each(F&& f) const {
+    for_each_segment([&](const T* data, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            f(data[i]);
+        }
+    });
+}
+
+template <typename T>
+bool CompressedDeque<T>::empty() const {
+    return size() == 0;
+}
+
+template <typename T>
+size_t CompressedDeque<T>::size() const {
+    return head_size + sealed.size() * CHUNK_SIZE + tail_size;
+}
+
+template <typename T>
+size_t CompressedDeque<T>::sealed_chunks() const {
+    return sealed.size();
+}
+
+// Everything allocated, not just the packed payload: every slot of the chunks backing
+// the sealed Deque (spares included), their map entries, each payload vector's capacity,
+// and a malloc header per heap block
+template <typename T>
+size_t CompressedDeque<T>::memory_usage() const {
+    size_t slots = sealed.size() + sealed.capacity_front() + sealed.capacity_back();
+    size_t blocks = slots / CHUNK_SIZE;
+    size_t bytes = sizeof(*this) + slots * sizeof(SealedChunk) + blocks * (sizeof(void*) + ALLOCATION_OVERHEAD);
+    for (size_t i = 0; i < sealed.size(); ++i) {
+        size_t capacity = sealed[i].words.capacity();
+        if (capacity > 0) {
+            bytes += capacity * sizeof(uint64_t) + ALLOCATION_OVERHEAD;
+        }
+    }
+    return bytes;
+}
+
+template <typename T>
+double CompressedDeque<T>::compression_ratio() const {
+    return static_cast<double>(size() * sizeof(T)) / static_cast<double>(memory_usage());
+}
@@ -0,0 +1,79 @@
+#ifndef COMPRESSED_DEQUE_H
+#define COMPRESSED_DEQUE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "Deque.h"
+
+// Deque of integers that keeps only its two end chunks raw.
+// Full interior chunks are sealed: the differences between neighbours are
+// zigzag-encoded, offset by their minimum (frame of reference) and bit-packed
+// at the smallest width that fits. Monotonic timestamps and small-range values
+// typically shrink to a few bits per element.
+//
+// Elements are returned by value since sealed elements have no address.
+// Sequential reads decode a chunk at a time, random access decodes the prefix
+// of a single chunk.
+template <typename T>
+class CompressedDeque {
+    static_assert(std::is_integral_v<T>, "CompressedDeque stores integer types");
+
+    private:
+        static constexpr size_t CHUNK_SIZE = 128;   // Elements per chunk, matches Deque
+        static constexpr size_t ALLOCATION_OVERHEAD = 16; // Typical malloc header per heap block
+
+        struct SealedChunk {
+            uint64_t first;      // Value of element 0
+            uint64_t reference;  // Smallest zigzag delta, subtracted before packing
+            uint8_t width;       // Bits per packed delta, 0..64
+            std::vector<uint64_t> words; // Packed deltas plus one padding word
+        };
+
+        std::array<T, CHUNK_SIZE> head; // Front elements occupy the last head_size slots
+        size_t head_size;
+        Deque<SealedChunk> sealed;       // Full chunks between head and tail
+        std::array<T, CHUNK_SIZE> tail; // Back elements occupy the first tail_size slots
+        size_t tail_size;
+
+        static SealedChunk seal(const T* values);
+        static void unseal(const SealedChunk& chunk, T* out, size_t count = CHUNK_SIZE);
+        static uint64_t unpack(const SealedChunk& chunk, size_t index);
+
+    public:
+        // Constructors
+        CompressedDeque();
+
+        // Modifiers
+        void push_back(T val);
+        void push_front(T val);
+        void pop_back();
+        void pop_front();
+        void clear();
+
+        // Element access
+        T at(size_t pos) const;
+        T operator[](size_t pos) const;
+        T front() const;
+        T back() const;
+        void copy_out(size_t pos, T* dest, size_t n) const;
+
+        // Sequential access: f(const T* data, size_t count) per chunk, front to back
+        template <typename F>
+        void for_each_segment(F&& f) const;
+        template <typename F>
+        void for_each(F&& f) const;
+
+        // Capacity
+        bool empty() const;
+        size_t size() const;
+        size_t sealed_chunks() const;
+        size_t memory_usage() const;       // Bytes held, including the raw end chunks
+        double compression_ratio() const;  // Raw element bytes / memory_usage()
+};
+
+#include "Compressed_Deque.cpp"
+#endif //COMPRESSED_DEQUE_H
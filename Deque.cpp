@@ -1,12 +1,14 @@
 #include "Deque.h"
 
 template <typename T>
-Deque<T>::Deque() : chunk_map{}, start{}, finish{} {}  
+Deque<T>::Deque()
+    : start{}, finish{}, chunk_map{}, spare_front{}, spare_back{}, num_elements{0}, pool{nullptr},
+      destruction_policy{DestructionPolicy::Immediate} {}  
 
 
 // Constructor: create a deque with n elements
 template <typename T>
-Deque<T>::Deque(size_t n) {
+Deque<T>::Deque(size_t n) : pool{nullptr}, destruction_policy{DestructionPolicy::Immediate} {
     // If n is zero, initialize an empty deque.
     if (n == 0) {
         num_elements = 0;
@@ -24,7 +26,7 @@ Deque<T>::Deque(size_t n) {
     
     // Allocate each chunk and initialize with default values.
     for (size_t i = 0; i < num_chunks; ++i) {
-        chunk_map[i] = std::make_unique<T[]>(CHUNK_SIZE);
+        chunk_map[i] = allocate_chunk();
         for (size_t j = 0; j < CHUNK_SIZE; ++j) {
             chunk_map[i][j] = T{};
         }
@@ -50,40 +52,159 @@ Deque<T>::Deque(size_t n) {
 
 // Copy constructor: deep copy from another deque
 template <typename T>
-Deque<T>::Deque(const Deque<T>& other) : num_elements(other.num_elements), chunk_map(other.chunk_map.size()) {
-    num_elements = other.num_elements;
-    for (size_t i = 0; i < other.chunk_map.size(); ++i) {
-        chunk_map[i] = std::make_unique<T[]>(CHUNK_SIZE);
-        for (size_t j = 0; j < CHUNK_SIZE; ++j) {
-            chunk_map[i][j] = other.chunk_map[i][j];
-        }
+Deque<T>::Deque(const Deque<T>& other)
+    : start{}, finish{}, chunk_map{}, spare_front{}, spare_back{}, num_elements{other.num_elements},
+      pool{other.pool}, destruction_policy{other.destruction_policy} {
+    if (other.num_elements == 0) {
+        num_elements = 0;
+        return;
     }
-    // Calculate iterator offsets for start and finish
-    size_t start_index = other.start.curr - other.start.first;
-    size_t finish_index = other.finish.curr - other.finish.first;
-    start = BaseIterator<T, false, false>(
-        chunk_map[0].get() + start_index,
-        chunk_map[0].get(),
-        chunk_map[0].get() + CHUNK_SIZE - 1,
-        chunk_map.data()
-    );
-    size_t last_chunk = chunk_map.size() - 1;
-    finish = BaseIterator<T, false, false>(
-        chunk_map[last_chunk].get() + finish_index,
-        chunk_map[last_chunk].get(),
-        chunk_map[last_chunk].get() + CHUNK_SIZE - 1,
-        chunk_map.data()
-    );
+    chunk_map.reserve(other.chunk_map.size());
+    for (const auto& chunk : other.chunk_map) {
+        chunk_map.push_back(allocate_chunk());
+        std::copy(chunk.get(), chunk.get() + CHUNK_SIZE, chunk_map.back().get());
+    }
+    rebind_iterators(other.start.curr - other.start.first);
 }
 
 // Move constructor: transfer ownership of resources
 template <typename T>
 Deque<T>::Deque(Deque<T>&& other) noexcept 
-    : num_elements(other.num_elements),
+    : start(other.start),
+      finish(other.finish),
       chunk_map(std::move(other.chunk_map)),
-      start(other.start),
-      finish(other.finish) {
+      spare_front(std::move(other.spare_front)),
+      spare_back(std::move(other.spare_back)),
+      num_elements(other.num_elements),
+      pool(other.pool),
+      destruction_policy(other.destruction_policy) {
+    other.chunk_map.clear();
+    other.spare_front.clear();
+    other.spare_back.clear();
     other.num_elements = 0;
+    other.start.curr = other.start.first = other.start.last = nullptr;
+    other.finish.curr = other.finish.first = other.finish.last = nullptr;
+}
+
+// Allocate one chunk, from the chunk pool when one is set
+template <typename T>
+Chunk<T> Deque<T>::allocate_chunk() {
+    if (pool) {
+        return Chunk<T>(pool->allocate(), ChunkDeleter<T>{pool});
+    }
+    return Chunk<T>(new T[CHUNK_SIZE]());
+}
+
+// An empty deque may take its first chunk from either pool
+template <typename T>
+Chunk<T> Deque<T>::acquire_front_chunk() {
+    if (spare_front.empty() && chunk_map.empty() && !spare_back.empty()) {
+        return acquire_back_chunk();
+    }
+    if (spare_front.empty()) {
+        return allocate_chunk();
+    }
+    Chunk<T> chunk = std::move(spare_front.back());
+    spare_front.pop_back();
+    return chunk;
+}
+
+template <typename T>
+Chunk<T> Deque<T>::acquire_back_chunk() {
+    if (spare_back.empty() && chunk_map.empty() && !spare_front.empty()) {
+        return acquire_front_chunk();
+    }
+    if (spare_back.empty()) {
+        return allocate_chunk();
+    }
+    Chunk<T> chunk = std::move(spare_back.back());
+    spare_back.pop_back();
+    return chunk;
+}
+
+// Take future chunks from source, or from new[] when it is nullptr.
+// Chunks allocated earlier keep their own deleter and are released normally.
+template <typename T>
+void Deque<T>::use_chunk_pool(ChunkPool<T>* source) {
+    static_assert(ChunkPool<T>::CHUNK_SIZE == CHUNK_SIZE, "Pool chunk size must match the deque");
+    pool = source;
+}
+
+template <typename T>
+void Deque<T>::use_heap_allocation() {
+    pool = nullptr;
+}
+
+// Choose how removed elements are destroyed; applies to later removals
+template <typename T>
+void Deque<T>::set_destruction_policy(DestructionPolicy policy) {
+    destruction_policy = policy;
+}
+
+template <typename T>
+DestructionPolicy Deque<T>::get_destruction_policy() const {
+    return destruction_policy;
+}
+
+// Slots always hold live objects, so "destroying" a removed element means
+// resetting it to T{} and letting it drop whatever it owns
+template <typename T>
+void Deque<T>::release_slots(T* first, T* last) {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        if (destruction_policy == DestructionPolicy::Immediate) {
+            for (T* ptr = first; ptr < last; ++ptr) {
+                *ptr = T{};
+            }
+        }
+    }
+}
+
+// Releasing a chunk destroys every slot in it, either here or on the reclaimer thread.
+// Entries whose chunk was already moved elsewhere are skipped.
+template <typename T>
+void Deque<T>::retire_chunks(size_t first, size_t last) {
+    if (destruction_policy == DestructionPolicy::Background && !std::is_trivially_destructible_v<T> &&
+        background_retire) {
+        for (size_t i = first; i < last; ++i) {
+            if (chunk_map[i]) {
+                background_retire(retire_chunk(std::move(chunk_map[i])));
+            }
+        }
+    }
+    chunk_map.erase(chunk_map.begin() + first, chunk_map.begin() + last);
+}
+
+// Move a chunk that left the map into a spare pool. Spare chunks must not keep removed
+// elements alive: under Immediate only [first, last) can still hold any, under Deferred
+// every slot may, so the whole chunk is reset. Under Background the chunk goes to the
+// reclaimer instead, which keeps the destructors off this thread.
+template <typename T>
+void Deque<T>::park_chunk(Chunk<T>&& chunk, std::vector<Chunk<T>>& spares, T* first, T* last) {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        if (destruction_policy == DestructionPolicy::Background && background_retire) {
+            background_retire(retire_chunk(std::move(chunk)));
+            return;
+        }
+        if (destruction_policy != DestructionPolicy::Immediate) {
+            first = chunk.get();
+            last = first + CHUNK_SIZE;
+        }
+        for (T* ptr = first; ptr < last; ++ptr) {
+            *ptr = T{};
+        }
+    }
+    spares.push_back(std::move(chunk));
+}
+
+// The deque just lost its last element: park its only chunk in pool instead of
+// freeing it, so a queue that keeps emptying and refilling does not allocate
+template <typename T>
+void Deque<T>::recycle_last_chunk(std::vector<Chunk<T>>& pool) {
+    park_chunk(std::move(chunk_map.back()), pool, start.curr, finish.curr + 1);
+    chunk_map.clear();
+    start.curr = finish.curr = nullptr;
+    start.first = start.last = nullptr;
+    finish.first = finish.last = nullptr;
 }
 
 // Add an element to the back of the deque
@@ -92,7 +213,7 @@ void Deque<T>::push_back(const T& val) {
     ++num_elements;
     // If finish.curr is not set, allocate a new chunk
     if (!finish.curr) {
-        chunk_map.push_back(std::make_unique<T[]>(CHUNK_SIZE));
+        chunk_map.push_back(acquire_back_chunk());
         start.first = finish.first = chunk_map.back().get();
         start.last = finish.last = start.first + CHUNK_SIZE - 1;
         start.curr = finish.curr = start.first;
@@ -106,7 +227,7 @@ void Deque<T>::push_back(const T& val) {
         return;
     }
     // Otherwise, allocate a new chunk and update finish iterator
-    chunk_map.push_back(std::make_unique<T[]>(CHUNK_SIZE));
+    chunk_map.push_back(acquire_back_chunk());
     finish.first = chunk_map.back().get();
     finish.last = finish.first + CHUNK_SIZE - 1;
     finish.curr = finish.first;
@@ -118,11 +239,11 @@ template <typename T>
 void Deque<T>::push_front(const T& val) {
     ++num_elements;
     if (!start.curr) {
-        // If deque is empty, create a new chunk
-        chunk_map.push_back(std::make_unique<T[]>(CHUNK_SIZE));
+        // If deque is empty, create a new chunk and fill it from its end
+        chunk_map.push_front(acquire_front_chunk());
         start.first = finish.first = chunk_map.back().get();
         start.last = finish.last = start.first + CHUNK_SIZE - 1;
-        start.curr = finish.curr = start.first;
+        start.curr = finish.curr = start.last;
         *start.curr = val;
         return;
     }
@@ -132,8 +253,8 @@ void Deque<T>::push_front(const T& val) {
         *start.curr = val;
         return;
     }
-    // Otherwise, insert a new chunk at the beginning
-    chunk_map.insert(chunk_map.begin(), std::make_unique<T[]>(CHUNK_SIZE));
+    // Otherwise, put a new chunk in the free map slot before the first one
+    chunk_map.push_front(acquire_front_chunk());
     start.first = chunk_map.front().get();
     start.last = start.first + CHUNK_SIZE - 1;
     start.curr = start.last;
@@ -152,12 +273,17 @@ void Deque<T>::pop_back() {
     }
     --num_elements;
     // If not at the first element of the chunk, simply move the pointer back
-    if (finish.curr > finish.first) {
+    if (finish.curr > finish.first && num_elements > 0) {
+        release_slots(finish.curr, finish.curr + 1);
         --finish.curr;
         return;
     }
-    // Otherwise, remove the last chunk
-    chunk_map.pop_back();
+    // Otherwise, remove the last chunk; the very last one is kept for the next push
+    if (chunk_map.size() == 1) {
+        recycle_last_chunk(spare_back);
+        return;
+    }
+    retire_chunks(chunk_map.size() - 1, chunk_map.size());
     if (chunk_map.empty()) {
         start.curr = finish.curr = nullptr;
         start.first = start.last = nullptr;
@@ -177,12 +303,17 @@ void Deque<T>::pop_front() {
     }
     --num_elements;
     // If there are more elements in the first chunk, move the pointer forward
-    if (start.curr < start.last) {
+    if (start.curr < start.last && num_elements > 0) {
+        release_slots(start.curr, start.curr + 1);
         ++start.curr;
         return;
     }
-    // Otherwise, remove the first chunk
-    chunk_map.erase(chunk_map.begin());
+    // Otherwise, remove the first chunk; the very last one is kept for the next push
+    if (chunk_map.size() == 1) {
+        recycle_last_chunk(spare_front);
+        return;
+    }
+    retire_chunks(0, 1);
     if (chunk_map.empty()) {
         start.curr = finish.curr = nullptr;
         start.first = start.last = nullptr;
@@ -194,12 +325,53 @@ void Deque<T>::pop_front() {
     start.curr = start.first;
 }
 
+// Pop into out if the deque is not empty
+template <typename T>
+bool Deque<T>::try_pop_front(T& out) {
+    if (num_elements == 0) {
+        return false;
+    }
+    out = std::move(*start.curr);
+    unchecked_pop_front();
+    return true;
+}
+
+template <typename T>
+bool Deque<T>::try_pop_back(T& out) {
+    if (num_elements == 0) {
+        return false;
+    }
+    out = std::move(*finish.curr);
+    unchecked_pop_back();
+    return true;
+}
+
+template <typename T>
+std::optional<T> Deque<T>::try_pop_front() {
+    if (num_elements == 0) {
+        return std::nullopt;
+    }
+    std::optional<T> out(std::move(*start.curr));
+    unchecked_pop_front();
+    return out;
+}
+
+template <typename T>
+std::optional<T> Deque<T>::try_pop_back() {
+    if (num_elements == 0) {
+        return std::nullopt;
+    }
+    std::optional<T> out(std::move(*finish.curr));
+    unchecked_pop_back();
+    return out;
+}
+
 // Insert an element at a given iterator position
 template <typename T>
 BaseIterator<T, false, false> Deque<T>::insert(BaseIterator<T, false, false> pos, const T& val) {
     if (chunk_map.empty()) {
         // If empty, push_front
-        chunk_map.push_back(std::make_unique<T[]>(CHUNK_SIZE));
+        chunk_map.push_back(allocate_chunk());
         start.first = finish.first = chunk_map.back().get();
         start.last = finish.last = start.first + CHUNK_SIZE - 1;
         start.curr = finish.curr = start.first;
@@ -229,7 +401,7 @@ BaseIterator<T, false, false> Deque<T>::insert(BaseIterator<T, false, false> pos
     // Otherwise, allocate a new chunk and insert there
     T* new_chunk = new T[CHUNK_SIZE];
     size_t chunk_index = std::find(chunk_map.begin(), chunk_map.end(), pos.first) - chunk_map.begin();
-    chunk_map.insert(chunk_map.begin() + chunk_index + 1, std::make_unique<T[]>(CHUNK_SIZE));
+    chunk_map.insert(chunk_map.begin() + chunk_index + 1, allocate_chunk());
     T* current = pos.curr;
     T* new_chunk_ptr = new_chunk;
     while (current <= pos.last) {
@@ -238,7 +410,7 @@ BaseIterator<T, false, false> Deque<T>::insert(BaseIterator<T, false, false> pos
         ++current;
     }
     *new_chunk_ptr = val;
-    chunk_map[chunk_index + 1] = std::unique_ptr<T[]>(new_chunk);
+    chunk_map[chunk_index + 1] = Chunk<T>(new_chunk);
     return BaseIterator<T, false, false>(new_chunk, new_chunk + (pos.curr - pos.first), new_chunk + CHUNK_SIZE - 1, chunk_map.data(), chunk_index + 1);
 }
 
@@ -247,7 +419,7 @@ template <typename T>
 template <typename... Args>
 BaseIterator<T, false, false> Deque<T>::emplace(BaseIterator<T, false, false> pos, Args&&... args) {
     if (chunk_map.empty()) {
-        chunk_map.push_back(std::make_unique<T[]>(CHUNK_SIZE));
+        chunk_map.push_back(allocate_chunk());
         start.first = finish.first = chunk_map.back().get();
         start.last = finish.last = start.first + CHUNK_SIZE - 1;
         start.curr = finish.curr = start.first;
@@ -276,7 +448,7 @@ BaseIterator<T, false, false> Deque<T>::emplace(BaseIterator<T, false, false> po
     }
     T* new_chunk = new T[CHUNK_SIZE];
     size_t chunk_index = std::find(chunk_map.begin(), chunk_map.end(), pos.first) - chunk_map.begin();
-    chunk_map.insert(chunk_map.begin() + chunk_index + 1, std::make_unique<T[]>(CHUNK_SIZE));
+    chunk_map.insert(chunk_map.begin() + chunk_index + 1, allocate_chunk());
     T* current = pos.curr;
     T* new_chunk_ptr = new_chunk;
     while (current <= pos.last) {
@@ -285,21 +457,87 @@ BaseIterator<T, false, false> Deque<T>::emplace(BaseIterator<T, false, false> po
         ++current;
     }
     new (new_chunk_ptr) T(std::forward<Args>(args)...);
-    chunk_map[chunk_index + 1] = std::unique_ptr<T[]>(new_chunk);
+    chunk_map[chunk_index + 1] = Chunk<T>(new_chunk);
     return BaseIterator<T, false, false>(new_chunk, new_chunk + (pos.curr - pos.first), new_chunk + CHUNK_SIZE - 1, chunk_map.data(), chunk_index + 1);
 }
 
-// Clear all elements from the deque
+// Insert val after any equal elements of a deque sorted by cmp.
+// The position is found by binary search and the shorter side is shifted by one.
 template <typename T>
-void Deque<T>::clear() {
-    for (auto& chunk : chunk_map) {
-        T* start_ptr = chunk.get();
-        T* end_ptr = start_ptr + CHUNK_SIZE;
-        for (T* ptr = start_ptr; ptr < end_ptr; ++ptr) {
-            ptr->~T();
+template <typename Compare>
+size_t Deque<T>::sorted_insert(const T& val, Compare cmp) {
+    size_t low = 0;
+    size_t high = num_elements;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (cmp(val, *element_ptr(mid))) {
+            high = mid;
+        } else {
+            low = mid + 1;
         }
     }
-    chunk_map.clear();
+    size_t pos = low;
+    if (pos >= num_elements / 2) {
+        size_t n = num_elements;
+        push_back(val);
+        for (size_t i = n; i > pos; --i) {
+            *element_ptr(i) = std::move(*element_ptr(i - 1));
+        }
+    } else {
+        push_front(val);
+        for (size_t i = 0; i < pos; ++i) {
+            *element_ptr(i) = std::move(*element_ptr(i + 1));
+        }
+    }
+    *element_ptr(pos) = val;
+    return pos;
+}
+
+// Merge a batch sorted by cmp into a deque sorted by cmp.
+// The back grows once by the batch size, then a single backward pass moves
+// existing elements up only as far as the batch minimum reaches.
+template <typename T>
+template <typename BidirIt, typename Compare>
+void Deque<T>::merge_sorted(BidirIt first, BidirIt last, Compare cmp) {
+    size_t count = std::distance(first, last);
+    if (count == 0) {
+        return;
+    }
+    // Existing elements before the first batch element stay where they are
+    size_t low = 0;
+    size_t high = num_elements;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (cmp(*first, *element_ptr(mid))) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    size_t keep = low;
+    size_t old_size = num_elements;
+    extend_back(count);
+
+    size_t read = old_size;          // One past the next existing element to place
+    size_t write = old_size + count; // One past the next slot to fill
+    BidirIt batch = last;
+    while (batch != first) {
+        BidirIt candidate = std::prev(batch);
+        if (read > keep && cmp(*candidate, *element_ptr(read - 1))) {
+            *element_ptr(--write) = std::move(*element_ptr(--read));
+        } else {
+            *element_ptr(--write) = *candidate;
+            batch = candidate;
+        }
+    }
+}
+
+// Clear all elements from the deque
+template <typename T>
+void Deque<T>::clear() {
+    // Releasing a chunk destroys all of its slots
+    retire_chunks(0, chunk_map.size());
+    num_elements = 0;
     start.curr = finish.curr = nullptr;
     start.first = start.last = nullptr;
     finish.first = finish.last = nullptr;
@@ -308,95 +546,231 @@ void Deque<T>::clear() {
 // Erase an element at a given position and return an iterator to the next element
 template <typename T>
 BaseIterator<T, false, false> Deque<T>::erase(BaseIterator<T, false, false> pos) {
-    if (chunk_map.empty()) {
+    if (num_elements == 0) {
         throw std::out_of_range("Cannot erase from an empty deque");
     }
-    if (pos == start) {
-        pop_front();
-        return start;
-    }
-    if (pos == finish) {
-        pop_back();
-        return finish;
-    }
-    T* erase_pos = pos.curr;
-    T* current = erase_pos;
-    erase_pos->~T();
-    while (current < finish.curr) {
-        *current = std::move(*(current + 1));
-        ++current;
-    }
-    --finish.curr;
-    if (start.curr > start.last) {
-        chunk_map.erase(std::find(chunk_map.begin(), chunk_map.end(), pos.first));
-        if (chunk_map.empty()) {
-            start.curr = finish.curr = nullptr;
-            start.first = start.last = nullptr;
-            finish.first = finish.last = nullptr;
-        } else {
-            start.first = chunk_map.front().get();
-            start.last = start.first + CHUNK_SIZE - 1;
-            start.curr = start.first;
+    size_t index = static_cast<size_t>(pos - begin());
+    // Close the gap from the shorter side, then drop the freed end slot like a pop does
+    if (index < num_elements / 2) {
+        for (size_t i = index; i > 0; --i) {
+            *element_ptr(i) = std::move(*element_ptr(i - 1));
+        }
+        unchecked_pop_front();
+    } else {
+        for (size_t i = index; i + 1 < num_elements; ++i) {
+            *element_ptr(i) = std::move(*element_ptr(i + 1));
         }
+        unchecked_pop_back();
     }
-    return BaseIterator<T, false, false>(pos.first, erase_pos, pos.last, chunk_map.data(), 0);
+    return begin() + static_cast<std::ptrdiff_t>(index);
 }
 
 // Emplace an element at the back of the deque
 template <typename T>
 template <typename... Args>
 void Deque<T>::emplace_back(Args&&... args) {
-    if (!finish.curr || finish.curr >= finish.last) {
-        chunk_map.push_back(std::make_unique<T[]>(CHUNK_SIZE));
+    T val(std::forward<Args>(args)...);
+    ++num_elements;
+    if (!finish.curr) {
+        chunk_map.push_back(acquire_back_chunk());
+        start.first = finish.first = chunk_map.back().get();
+        start.last = finish.last = start.first + CHUNK_SIZE - 1;
+        start.curr = finish.curr = start.first;
+    } else if (finish.curr < finish.last) {
+        ++finish.curr;
+    } else {
+        chunk_map.push_back(acquire_back_chunk());
         finish.first = chunk_map.back().get();
         finish.last = finish.first + CHUNK_SIZE - 1;
         finish.curr = finish.first;
-        if (chunk_map.size() == 1) {
-            start = finish;
+    }
+    *finish.curr = std::move(val);
+}
+
+// Remove the first n elements, releasing whole chunks at once
+template <typename T>
+void Deque<T>::consume_front(size_t n) {
+    if (n > num_elements) {
+        throw std::out_of_range("Cannot consume more elements than the deque holds");
+    }
+    if (n == 0) {
+        return;
+    }
+    num_elements -= n;
+    if (num_elements == 0) {
+        retire_chunks(0, chunk_map.size());
+        start.curr = finish.curr = nullptr;
+        start.first = start.last = nullptr;
+        finish.first = finish.last = nullptr;
+        return;
+    }
+    size_t offset = (start.curr - start.first) + n;
+    size_t chunks_to_drop = offset / CHUNK_SIZE;
+    if (chunks_to_drop > 0) {
+        retire_chunks(0, chunks_to_drop);
+        start.first = chunk_map.front().get();
+        start.last = start.first + CHUNK_SIZE - 1;
+        start.curr = start.first;
+    }
+    T* new_front = start.first + offset % CHUNK_SIZE;
+    release_slots(start.curr, new_front);
+    start.curr = new_front;
+}
+
+// Point start and finish at the live range, given the offset of the first
+// element in chunk_map[0]; num_elements must already be up to date
+template <typename T>
+void Deque<T>::rebind_iterators(size_t front_offset) {
+    if (num_elements == 0) {
+        start.curr = finish.curr = nullptr;
+        start.first = start.last = nullptr;
+        finish.first = finish.last = nullptr;
+        return;
+    }
+    start.first = chunk_map.front().get();
+    start.last = start.first + CHUNK_SIZE - 1;
+    start.curr = start.first + front_offset;
+    size_t last_index = front_offset + num_elements - 1;
+    finish.first = chunk_map[last_index / CHUNK_SIZE].get();
+    finish.last = finish.first + CHUNK_SIZE - 1;
+    finish.curr = finish.first + last_index % CHUNK_SIZE;
+}
+
+// Move other's elements to the back. When the seam lines up with the chunk
+// grid only the boundary chunk is touched and the rest of other's chunks are
+// moved over in O(chunks). Otherwise the smaller side is re-packed element by element.
+template <typename T>
+void Deque<T>::append_deque(Deque&& other) {
+    if (this == &other || other.num_elements == 0) {
+        return;
+    }
+    if (num_elements == 0) {
+        retire_chunks(0, chunk_map.size());
+        chunk_map = std::move(other.chunk_map);
+        num_elements = other.num_elements;
+        rebind_iterators(other.start.curr - other.start.first);
+        other.chunk_map.clear();
+        other.num_elements = 0;
+        other.rebind_iterators(0);
+        return;
+    }
+    size_t front_offset = start.curr - start.first;
+    size_t tail_used = (front_offset + num_elements) % CHUNK_SIZE; // 0 when the tail chunk is full
+    size_t other_offset = other.start.curr - other.start.first;
+    if (tail_used == other_offset) {
+        size_t first_chunk = 0;
+        if (tail_used != 0) {
+            // Fill the rest of our tail chunk from other's first chunk, then drop that chunk
+            size_t count = std::min(CHUNK_SIZE - other_offset, other.num_elements);
+            std::move(other.start.curr, other.start.curr + count, finish.curr + 1);
+            first_chunk = 1;
+        }
+        chunk_map.reserve(chunk_map.size() + other.chunk_map.size() - first_chunk);
+        std::move(other.chunk_map.begin() + first_chunk, other.chunk_map.end(), std::back_inserter(chunk_map));
+        num_elements += other.num_elements;
+        rebind_iterators(front_offset);
+        // Only other's first chunk, if its elements were copied out, still owns storage
+        other.retire_chunks(0, first_chunk);
+        other.chunk_map.clear();
+        other.num_elements = 0;
+        other.rebind_iterators(0);
+    } else if (other.num_elements <= num_elements) {
+        // Move other's elements into our new tail, walking both chunk grids at once
+        size_t pos = num_elements;
+        extend_back(other.num_elements);
+        T* source = nullptr;
+        size_t source_left = 0;
+        size_t source_index = 0;
+        for_each_segment(pos, other.num_elements, [&](T* dest, size_t length) {
+            while (length > 0) {
+                if (source_left == 0) {
+                    source = other.element_ptr(source_index);
+                    source_left = CHUNK_SIZE - (other_offset + source_index) % CHUNK_SIZE;
+                }
+                size_t count = std::min(length, source_left);
+                dest = std::move(source, source + count, dest);
+                source += count;
+                source_left -= count;
+                source_index += count;
+                length -= count;
+            }
+            return true;
+        });
+        other.clear();
+    } else {
+        // We are the smaller side: re-pack our elements onto other's front and take its storage
+        for (size_t i = num_elements; i > 0; --i) {
+            other.push_front(std::move(*element_ptr(i - 1)));
         }
+        clear();
+        append_deque(std::move(other));
     }
-    new (finish.curr) T(std::forward<Args>(args)...);
-    ++finish.curr;
+}
+
+// Split off [pos, size()) into a new deque. Whole chunks after pos are moved;
+// only the elements sharing pos's chunk are moved into a fresh chunk.
+template <typename T>
+Deque<T> Deque<T>::split_at(size_t pos) {
+    if (pos > num_elements) {
+        throw std::out_of_range("Deque index out of range");
+    }
+    Deque<T> tail;
+    tail.pool = pool;
+    tail.destruction_policy = destruction_policy;
+    if (pos == num_elements) {
+        return tail;
+    }
+    size_t front_offset = start.curr - start.first;
+    size_t index = front_offset + pos;
+    size_t chunk_index = index / CHUNK_SIZE;
+    size_t slot = index % CHUNK_SIZE;
+    size_t tail_count = num_elements - pos;
+    size_t first_moved = chunk_index;
+    if (slot != 0) {
+        // The boundary chunk is shared: move its tail elements into a new chunk at the same slots
+        tail.chunk_map.push_back(tail.allocate_chunk());
+        T* source = chunk_map[chunk_index].get();
+        size_t count = std::min(CHUNK_SIZE - slot, tail_count);
+        std::move(source + slot, source + slot + count, tail.chunk_map.back().get() + slot);
+        release_slots(source + slot, source + slot + count);
+        first_moved = chunk_index + 1;
+    }
+    tail.chunk_map.reserve(tail.chunk_map.size() + chunk_map.size() - first_moved);
+    std::move(chunk_map.begin() + first_moved, chunk_map.end(), std::back_inserter(tail.chunk_map));
+    chunk_map.erase(chunk_map.begin() + first_moved, chunk_map.end());
+    tail.num_elements = tail_count;
+    tail.rebind_iterators(slot);
+    num_elements = pos;
+    if (num_elements == 0) {
+        retire_chunks(0, chunk_map.size());
+    }
+    rebind_iterators(front_offset);
+    return tail;
+}
+
+// Insert all of other's elements before pos by splitting and re-joining
+template <typename T>
+void Deque<T>::splice(size_t pos, Deque&& other) {
+    if (this == &other) {
+        return;
+    }
+    Deque<T> tail = split_at(pos);
+    append_deque(std::move(other));
+    append_deque(std::move(tail));
 }
 
 // Resize the deque to new_size, initializing new elements with val if expanding
 template <typename T>
 void Deque<T>::resize(size_t new_size, const T& val) {
-    size_t current_size = size();
+    size_t current_size = num_elements;
     if (new_size > current_size) {
-        size_t elements_to_add = new_size - current_size;
-        while (elements_to_add > 0) {
-            size_t space_in_current_chunk = (finish.last - finish.curr) + 1;
-            size_t elements_to_add_in_chunk = std::min(space_in_current_chunk, elements_to_add);
-            for (size_t i = 0; i < elements_to_add_in_chunk; ++i) {
-                emplace_back(val);
-            }
-            elements_to_add -= elements_to_add_in_chunk;
-            if (elements_to_add > 0) {
-                chunk_map.push_back(std::make_unique<T[]>(CHUNK_SIZE));
-                finish.first = chunk_map.back().get();
-                finish.last = finish.first + CHUNK_SIZE - 1;
-                finish.curr = finish.first;
-            }
-        }
+        extend_back(new_size - current_size);
+        for_each_segment(current_size, new_size - current_size, [&](T* data, size_t length) {
+            std::fill(data, data + length, val);
+            return true;
+        });
     } else if (new_size < current_size) {
-        size_t elements_to_remove = current_size - new_size;
-        while (elements_to_remove > 0) {
-            if (finish.curr == finish.first) {
-                chunk_map.pop_back();
-                if (!chunk_map.empty()) {
-                    finish.first = chunk_map.back().get();
-                    finish.last = finish.first + CHUNK_SIZE - 1;
-                    finish.curr = finish.last;
-                } else {
-                    finish = start = {};
-                    break;
-                }
-            }
-            size_t elements_to_remove_in_chunk = std::min(static_cast<size_t>(finish.curr - finish.first + 1), elements_to_remove);
-            finish.curr -= elements_to_remove_in_chunk;
-            elements_to_remove -= elements_to_remove_in_chunk;
-        }
+        truncate_back(current_size - new_size);
     }
 }
 
@@ -404,34 +778,26 @@ void Deque<T>::resize(size_t new_size, const T& val) {
 template <typename T>
 void Deque<T>::swap(Deque<T>& other) noexcept {
     std::swap(chunk_map, other.chunk_map);
+    std::swap(spare_front, other.spare_front);
+    std::swap(spare_back, other.spare_back);
     std::swap(start.first, other.start.first);
     std::swap(start.curr, other.start.curr);
     std::swap(start.last, other.start.last);
     std::swap(finish.first, other.finish.first);
     std::swap(finish.curr, other.finish.curr);
     std::swap(finish.last, other.finish.last);
+    std::swap(num_elements, other.num_elements);
+    std::swap(pool, other.pool);
+    std::swap(destruction_policy, other.destruction_policy);
 }
 
-// Copy assignment operator
+// Copy assignment operator: copy into a fresh deque, then take over its chunks
 template <typename T>
 Deque<T>& Deque<T>::operator=(const Deque& other) {
     if (this != &other) {
+        Deque<T> copy(other);
         clear();
-        for (const auto& chunk : other.chunk_map) {
-            chunk_map.push_back(std::make_unique<T[]>(CHUNK_SIZE));
-            std::copy(chunk.get(), chunk.get() + CHUNK_SIZE, chunk_map.back().get());
-        }
-        if (!chunk_map.empty()) {
-            size_t start_offset = other.start.curr - other.start.first;
-            size_t finish_offset = other.finish.curr - other.finish.first;
-            start.first = chunk_map[0].get();
-            start.last = start.first + CHUNK_SIZE - 1;
-            start.curr = start.first + start_offset;
-            size_t finish_chunk_index = other.chunk_map.size() - 1;
-            finish.first = chunk_map[finish_chunk_index].get();
-            finish.last = finish.first + CHUNK_SIZE - 1;
-            finish.curr = finish.first + finish_offset;
-        }
+        swap(copy);
     }
     return *this;
 }
@@ -442,8 +808,17 @@ Deque<T>& Deque<T>::operator=(Deque&& other) noexcept {
     if (this != &other) {
         clear();
         chunk_map = std::move(other.chunk_map);
+        spare_front = std::move(other.spare_front);
+        spare_back = std::move(other.spare_back);
         start = other.start;
         finish = other.finish;
+        num_elements = other.num_elements;
+        pool = other.pool;
+        destruction_policy = other.destruction_policy;
+        other.chunk_map.clear();
+        other.spare_front.clear();
+        other.spare_back.clear();
+        other.num_elements = 0;
         other.start.curr = other.start.first = other.start.last = nullptr;
         other.finish.curr = other.finish.first = other.finish.last = nullptr;
     }
@@ -453,36 +828,25 @@ Deque<T>& Deque<T>::operator=(Deque&& other) noexcept {
 // Access element at pos with bounds checking
 template <typename T>
 T& Deque<T>::at(size_t pos) {
-    size_t total_size = size();
-    if (pos >= total_size) {
+    if (pos >= num_elements) {
         throw std::out_of_range("Deque index out of range");
     }
-    size_t cumulative_size = 0;
-    for (const auto& chunk : chunk_map) {
-        size_t current_chunk_size = (chunk == chunk_map.back()) ? (finish.curr - chunk.get() + 1) : CHUNK_SIZE;
-        if (cumulative_size + current_chunk_size > pos) {
-            return chunk.get()[pos - cumulative_size];
-        }
-        cumulative_size += current_chunk_size;
-    }
-    throw std::out_of_range("Unexpected error in at method");
+    return *element_ptr(pos);
 }
 
 template <typename T>
 const T& Deque<T>::at(size_t pos) const {
-    size_t total_size = size();
-    if (pos >= total_size) {
+    if (pos >= num_elements) {
         throw std::out_of_range("Deque index out of range");
     }
-    size_t cumulative_size = 0;
-    for (const auto& chunk : chunk_map) {
-        size_t current_chunk_size = (chunk == chunk_map.back()) ? (finish.curr - chunk.get() + 1) : CHUNK_SIZE;
-        if (cumulative_size + current_chunk_size > pos) {
-            return chunk.get()[pos - cumulative_size];
-        }
-        cumulative_size += current_chunk_size;
-    }
-    throw std::out_of_range("Unexpected error in at method");
+    return *element_ptr(pos);
+}
+
+// Locate element pos in O(1): every chunk but the first is full from slot 0
+template <typename T>
+T* Deque<T>::element_ptr(size_t pos) const {
+    size_t index = (start.curr - start.first) + pos;
+    return chunk_map[index / CHUNK_SIZE].get() + index % CHUNK_SIZE;
 }
 
 // Return first element
@@ -519,15 +883,67 @@ const T& Deque<T>::back() const {
     return *finish.curr;
 }
 
-// Operator[] uses at() for bounds checking
+// Operator[] is unchecked in release builds; use at() for bounds checking
 template <typename T>
 T& Deque<T>::operator[](size_t pos) {
-    return at(pos);
+    assert(pos < num_elements && "Deque index out of range");
+    return *element_ptr(pos);
 }
 
 template <typename T>
 const T& Deque<T>::operator[](size_t pos) const {
-    return at(pos);
+    assert(pos < num_elements && "Deque index out of range");
+    return *element_ptr(pos);
+}
+
+// Unchecked element access
+template <typename T>
+T& Deque<T>::unchecked_front() {
+    assert(num_elements > 0 && "Deque is empty");
+    return *start.curr;
+}
+
+template <typename T>
+const T& Deque<T>::unchecked_front() const {
+    assert(num_elements > 0 && "Deque is empty");
+    return *start.curr;
+}
+
+template <typename T>
+T& Deque<T>::unchecked_back() {
+    assert(num_elements > 0 && "Deque is empty");
+    return *finish.curr;
+}
+
+template <typename T>
+const T& Deque<T>::unchecked_back() const {
+    assert(num_elements > 0 && "Deque is empty");
+    return *finish.curr;
+}
+
+// Stay inside the boundary chunk when possible, otherwise let pop_front release it
+template <typename T>
+void Deque<T>::unchecked_pop_front() {
+    assert(num_elements > 0 && "Cannot pop from an empty deque");
+    if (start.curr < start.last && num_elements > 1) {
+        release_slots(start.curr, start.curr + 1);
+        ++start.curr;
+        --num_elements;
+        return;
+    }
+    pop_front();
+}
+
+template <typename T>
+void Deque<T>::unchecked_pop_back() {
+    assert(num_elements > 0 && "Cannot pop from an empty deque");
+    if (finish.curr > finish.first && num_elements > 1) {
+        release_slots(finish.curr, finish.curr + 1);
+        --finish.curr;
+        --num_elements;
+        return;
+    }
+    pop_back();
 }
 
 // Comparison operators
@@ -577,13 +993,35 @@ bool operator>=(const Deque<T>& lhs, const Deque<T>& rhs) {
     return !(lhs < rhs);
 }
 
+template <typename T>
+template <bool IsConst, bool IsReverse>
+BaseIterator<T, IsConst, IsReverse> Deque<T>::iterator_at(size_t chunk, std::ptrdiff_t slot) const {
+    using Chunkpointer = typename BaseIterator<T, IsConst, IsReverse>::Chunkpointer;
+    Chunkpointer map = const_cast<Chunkpointer>(chunk_map.data());
+    Chunkpointer node = map + chunk;
+    return BaseIterator<T, IsConst, IsReverse>(node->get() + slot, node, map, map + chunk_map.size() - 1);
+}
+
 // Begin returns iterator to first element
 template <typename T>
 BaseIterator<T, false, false> Deque<T>::begin() {
     if (num_elements == 0) {
         return BaseIterator<T, false, false>();
     }
-    return start;
+    return iterator_at<false, false>(0, start.curr - start.first);
+}
+
+template <typename T>
+BaseIterator<T, true, false> Deque<T>::begin() const {
+    return cbegin();
+}
+
+template <typename T>
+BaseIterator<T, true, false> Deque<T>::cbegin() const {
+    if (num_elements == 0) {
+        return BaseIterator<T, true, false>();
+    }
+    return iterator_at<true, false>(0, start.curr - start.first);
 }
 
 // End returns iterator one past the last element
@@ -592,48 +1030,64 @@ BaseIterator<T, false, false> Deque<T>::end() {
     if (num_elements == 0) {
         return BaseIterator<T, false, false>();
     }
-    BaseIterator<T, false, false> end_iter = finish;
-    if (end_iter.curr != nullptr) {
-        ++end_iter.curr;
-    }
-    return end_iter;
+    return iterator_at<false, false>(chunk_map.size() - 1, finish.curr - finish.first + 1);
 }
 
 template <typename T>
-BaseIterator<T, false, true> Deque<T>::cend() const {
-    BaseIterator<T, false, true> end_iter(finish.first, finish.curr, finish.last);
-    if (end_iter.curr != nullptr) {
-        ++end_iter.curr;
+BaseIterator<T, true, false> Deque<T>::end() const {
+    return cend();
+}
+
+template <typename T>
+BaseIterator<T, true, false> Deque<T>::cend() const {
+    if (num_elements == 0) {
+        return BaseIterator<T, true, false>();
     }
-    return end_iter;
+    return iterator_at<true, false>(chunk_map.size() - 1, finish.curr - finish.first + 1);
 }
 
+// Reverse iterators point at their element and step toward the front
 template <typename T>
-BaseIterator<T, true, false> Deque<T>::rbegin() {
-    return BaseIterator<T, true, false>(finish.first, finish.curr, finish.last);
+BaseIterator<T, false, true> Deque<T>::rbegin() {
+    if (num_elements == 0) {
+        return BaseIterator<T, false, true>();
+    }
+    return iterator_at<false, true>(chunk_map.size() - 1, finish.curr - finish.first);
 }
 
 template <typename T>
 BaseIterator<T, true, true> Deque<T>::crbegin() const {
-    return BaseIterator<T, true, true>(finish.first, finish.curr, finish.last);
+    if (num_elements == 0) {
+        return BaseIterator<T, true, true>();
+    }
+    return iterator_at<true, true>(chunk_map.size() - 1, finish.curr - finish.first);
 }
 
+// Rend is one before the first element
 template <typename T>
-BaseIterator<T, true, false> Deque<T>::rend() {
-    BaseIterator<T, true, false> rend_iter = start;
-    if (rend_iter.curr != nullptr) {
-        --rend_iter.curr;
+BaseIterator<T, false, true> Deque<T>::rend() {
+    if (num_elements == 0) {
+        return BaseIterator<T, false, true>();
     }
-    return rend_iter;
+    return iterator_at<false, true>(0, start.curr - start.first - 1);
 }
 
 template <typename T>
 BaseIterator<T, true, true> Deque<T>::crend() const {
-    BaseIterator<T, true, true> rend_iter(start.first, start.curr, start.last);
-    if (rend_iter.curr != nullptr) {
-        --rend_iter.curr;
+    if (num_elements == 0) {
+        return BaseIterator<T, true, true>();
     }
-    return rend_iter;
+    return iterator_at<true, true>(0, start.curr - start.first - 1);
+}
+
+template <typename T>
+template <typename F>
+void Deque<T>::for_each_reverse(F&& f) const {
+    for_each_segment_reverse([&](const T* data, size_t count) {
+        for (size_t i = count; i > 0; --i) {
+            f(data[i - 1]);
+        }
+    });
 }
 
 // Check if deque is empty
@@ -645,9 +1099,7 @@ bool Deque<T>::empty() const {
 // Calculate the size of the deque
 template <typename T>
 size_t Deque<T>::size() const {
-    if (num_elements == 0) return 0;
-    size_t total_size = (chunk_map.size() - 1) * CHUNK_SIZE + (finish.curr - finish.first + 1);
-    return total_size;
+    return num_elements;
 }
 
 template <typename T>
@@ -655,13 +1107,312 @@ size_t Deque<T>::max_size() const {
     return std::numeric_limits<size_t>::max() / sizeof(T);
 }
 
-// Shrink the allocated memory to fit current size
+// Shrink the allocated memory to fit current size.
+// Every chunk in the map holds live elements, so only reserved chunks and map slack are released.
 template <typename T>
 void Deque<T>::shrink_to_fit() {
-    while (chunk_map.size() > 1 && (finish.curr - finish.first + 1) < CHUNK_SIZE) {
-        chunk_map.pop_back();
+    spare_front.clear();
+    spare_back.clear();
+    spare_front.shrink_to_fit();
+    spare_back.shrink_to_fit();
+    chunk_map.shrink_to_fit();
+}
+
+// Make sure the next n push_front calls find their chunks and map slots already allocated
+template <typename T>
+void Deque<T>::reserve_front(size_t n) {
+    size_t available = capacity_front();
+    if (n <= available) {
+        return;
+    }
+    size_t chunks = (n - available + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunk_map.reserve_front(spare_front.size() + chunks);
+    spare_front.reserve(spare_front.size() + chunks);
+    for (size_t i = 0; i < chunks; ++i) {
+        spare_front.push_back(allocate_chunk());
+    }
+}
+
+template <typename T>
+void Deque<T>::reserve_back(size_t n) {
+    size_t available = capacity_back();
+    if (n <= available) {
+        return;
+    }
+    size_t chunks = (n - available + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunk_map.reserve(chunk_map.size() + spare_front.size() + spare_back.size() + chunks);
+    spare_back.reserve(spare_back.size() + chunks);
+    for (size_t i = 0; i < chunks; ++i) {
+        spare_back.push_back(allocate_chunk());
+    }
+}
+
+// Elements that fit before the front without allocating
+template <typename T>
+size_t Deque<T>::capacity_front() const {
+    size_t room = start.curr ? static_cast<size_t>(start.curr - start.first) : 0;
+    return room + spare_front.size() * CHUNK_SIZE;
+}
+
+// Elements that fit after the back without allocating
+template <typename T>
+size_t Deque<T>::capacity_back() const {
+    size_t room = finish.curr ? static_cast<size_t>(finish.last - finish.curr) : 0;
+    return room + spare_back.size() * CHUNK_SIZE;
+}
+
+
+template <typename T>
+template <typename F>
+void Deque<T>::for_each_segment(F&& f) const {
+    if (chunk_map.empty() || !start.curr) {
+        return;
+    }
+    if (chunk_map.size() == 1) {
+        f(static_cast<const T*>(start.curr), static_cast<size_t>(finish.curr - start.curr + 1));
+        return;
+    }
+    f(static_cast<const T*>(start.curr), static_cast<size_t>(start.last - start.curr + 1));
+    for (size_t i = 1; i + 1 < chunk_map.size(); ++i) {
+        if (PREFETCH_DISTANCE > 0 && i + PREFETCH_DISTANCE < chunk_map.size()) {
+            prefetch_chunk(chunk_map[i + PREFETCH_DISTANCE].get(), CHUNK_SIZE);
+        }
+        f(static_cast<const T*>(chunk_map[i].get()), CHUNK_SIZE);
+    }
+    f(static_cast<const T*>(finish.first), static_cast<size_t>(finish.curr - finish.first + 1));
+}
+
+// Mirror of for_each_segment, prefetching the chunks that come before
+template <typename T>
+template <typename F>
+void Deque<T>::for_each_segment_reverse(F&& f) const {
+    if (chunk_map.empty() || !start.curr) {
+        return;
+    }
+    if (chunk_map.size() == 1) {
+        f(static_cast<const T*>(start.curr), static_cast<size_t>(finish.curr - start.curr + 1));
+        return;
+    }
+    f(static_cast<const T*>(finish.first), static_cast<size_t>(finish.curr - finish.first + 1));
+    for (size_t i = chunk_map.size() - 2; i > 0; --i) {
+        if (PREFETCH_DISTANCE > 0 && i > PREFETCH_DISTANCE) {
+            prefetch_chunk(chunk_map[i - PREFETCH_DISTANCE].get(), CHUNK_SIZE);
+        }
+        f(static_cast<const T*>(chunk_map[i].get()), CHUNK_SIZE);
+    }
+    f(static_cast<const T*>(start.curr), static_cast<size_t>(start.last - start.curr + 1));
+}
+
+// FNV-1a, used to validate serialized payloads
+inline uint64_t deque_checksum(const void* data, size_t bytes, uint64_t hash) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < bytes; ++i) {
+        hash ^= p[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Write the live elements chunk by chunk after a fixed-size header
+template <typename T>
+void Deque<T>::save(std::ostream& out) const {
+    static_assert(std::is_trivially_copyable_v<T>, "Deque::save requires a trivially copyable T");
+    DequeFileHeader header{DequeFileHeader::MAGIC, DequeFileHeader::VERSION, sizeof(T), 0, CHUNK_SIZE, 0};
+    header.checksum = deque_checksum(nullptr, 0);
+    for_each_segment([&](const T* data, size_t count) {
+        header.count += count;
+        header.checksum = deque_checksum(data, count * sizeof(T), header.checksum);
+    });
+    char block[DequeFileHeader::DATA_OFFSET] = {};
+    std::memcpy(block, &header, sizeof(header));
+    out.write(block, sizeof(block));
+    for_each_segment([&](const T* data, size_t count) {
+        out.write(reinterpret_cast<const char*>(data), count * sizeof(T));
+    });
+    if (!out) {
+        throw std::runtime_error("Failed to write deque");
+    }
+}
+
+// Read a header, then read the payload straight into freshly allocated chunks
+template <typename T>
+void Deque<T>::load(std::istream& in) {
+    static_assert(std::is_trivially_copyable_v<T>, "Deque::load requires a trivially copyable T");
+    char block[DequeFileHeader::DATA_OFFSET];
+    if (!in.read(block, sizeof(block))) {
+        throw std::runtime_error("Failed to read deque header");
+    }
+    DequeFileHeader header;
+    std::memcpy(&header, block, sizeof(header));
+    if (header.magic != DequeFileHeader::MAGIC || header.version != DequeFileHeader::VERSION ||
+        header.element_size != sizeof(T)) {
+        throw std::runtime_error("Incompatible deque file");
+    }
+    clear();
+    uint64_t checksum = deque_checksum(nullptr, 0);
+    size_t remaining = header.count;
+    while (remaining > 0) {
+        size_t count = std::min(remaining, CHUNK_SIZE);
+        chunk_map.push_back(allocate_chunk());
+        char* dest = reinterpret_cast<char*>(chunk_map.back().get());
+        if (!in.read(dest, count * sizeof(T))) {
+            clear();
+            throw std::runtime_error("Truncated deque payload");
+        }
+        checksum = deque_checksum(dest, count * sizeof(T), checksum);
+        remaining -= count;
+    }
+    if (checksum != header.checksum) {
+        clear();
+        throw std::runtime_error("Deque checksum mismatch");
+    }
+    num_elements = header.count;
+    if (chunk_map.empty()) {
+        return;
+    }
+    start.first = chunk_map.front().get();
+    start.last = start.first + CHUNK_SIZE - 1;
+    start.curr = start.first;
+    finish.first = chunk_map.back().get();
+    finish.last = finish.first + CHUNK_SIZE - 1;
+    finish.curr = finish.first + (header.count - 1) % CHUNK_SIZE;
+}
+
+template <typename T>
+std::vector<std::span<const std::byte>> Deque<T>::export_spans(size_t pos, size_t count) const {
+    static_assert(std::is_trivially_copyable_v<T>, "Deque::export_spans requires a trivially copyable T");
+    std::vector<std::span<const std::byte>> spans;
+    for_each_segment(pos, count, [&](T* data, size_t length) {
+        spans.emplace_back(reinterpret_cast<const std::byte*>(data), length * sizeof(T));
+        return true;
+    });
+    return spans;
+}
+
+template <typename T>
+template <typename F>
+void Deque<T>::for_each_segment(size_t pos, size_t count, F&& f) const {
+    if (pos > num_elements) {
+        throw std::out_of_range("Deque index out of range");
+    }
+    count = std::min(count, num_elements - pos);
+    size_t index = (start.curr - start.first) + pos;
+    while (count > 0) {
+        size_t chunk_index = index / CHUNK_SIZE;
+        size_t slot = index % CHUNK_SIZE;
+        size_t length = std::min(count, CHUNK_SIZE - slot);
+        if (PREFETCH_DISTANCE > 0 && chunk_index + PREFETCH_DISTANCE < chunk_map.size()) {
+            prefetch_chunk(chunk_map[chunk_index + PREFETCH_DISTANCE].get(), CHUNK_SIZE);
+        }
+        if (!f(chunk_map[chunk_index].get() + slot, length)) {
+            return;
+        }
+        index += length;
+        count -= length;
+    }
+}
+
+// Grow the back by n slots; slots reused in the tail chunk keep their old values
+template <typename T>
+void Deque<T>::extend_back(size_t n) {
+    if (n == 0) {
+        return;
+    }
+    num_elements += n;
+    if (!finish.curr) {
+        chunk_map.push_back(acquire_back_chunk());
+        start.first = finish.first = chunk_map.back().get();
+        start.last = finish.last = start.first + CHUNK_SIZE - 1;
+        start.curr = finish.curr = start.first;
+        --n;
+    }
+    size_t room = std::min(static_cast<size_t>(finish.last - finish.curr), n);
+    finish.curr += room;
+    n -= room;
+    while (n > 0) {
+        chunk_map.push_back(acquire_back_chunk());
         finish.first = chunk_map.back().get();
         finish.last = finish.first + CHUNK_SIZE - 1;
-        finish.curr = finish.last;
+        size_t length = std::min(n, CHUNK_SIZE);
+        finish.curr = finish.first + length - 1;
+        n -= length;
+    }
+}
+
+template <typename T>
+template <typename F>
+void Deque<T>::for_each_back_room(size_t n, F&& f) const {
+    assert(n <= capacity_back() && "Deque back room must be reserved first");
+    if (finish.curr && finish.curr < finish.last && n > 0) {
+        size_t length = std::min(static_cast<size_t>(finish.last - finish.curr), n);
+        f(finish.curr + 1, length);
+        n -= length;
+    }
+    // acquire_back_chunk takes spare_back from its end
+    for (size_t i = spare_back.size(); i > 0 && n > 0; --i) {
+        size_t length = std::min(CHUNK_SIZE, n);
+        f(spare_back[i - 1].get(), length);
+        n -= length;
+    }
+}
+
+// Chunks emptied by the truncation go to spare_back, nearest last, so a caller that
+// over-extends and gives the surplus back (ByteDeque::write_from) does not allocate again
+template <typename T>
+void Deque<T>::truncate_back(size_t n) {
+    if (n > num_elements) {
+        throw std::out_of_range("Cannot truncate more elements than the deque holds");
+    }
+    if (n == 0) {
+        return;
+    }
+    num_elements -= n;
+    size_t front_offset = start.curr - start.first;
+    size_t last_index = front_offset + num_elements - 1;
+    size_t kept_chunks = num_elements == 0 ? 0 : last_index / CHUNK_SIZE + 1;
+    size_t old_chunks = chunk_map.size();
+    T* old_back = finish.curr;
+    for (size_t i = old_chunks; i > kept_chunks; --i) {
+        T* first = (i == 1) ? start.curr : chunk_map[i - 1].get();
+        T* last = (i == old_chunks) ? old_back + 1 : chunk_map[i - 1].get() + CHUNK_SIZE;
+        park_chunk(std::move(chunk_map[i - 1]), spare_back, first, last);
+    }
+    chunk_map.erase(chunk_map.begin() + kept_chunks, chunk_map.end());
+    if (num_elements == 0) {
+        start.curr = finish.curr = nullptr;
+        start.first = start.last = nullptr;
+        finish.first = finish.last = nullptr;
+        return;
+    }
+    if (kept_chunks < old_chunks) {
+        old_back = chunk_map.back().get() + CHUNK_SIZE - 1;
+    }
+    finish.first = chunk_map.back().get();
+    finish.last = finish.first + CHUNK_SIZE - 1;
+    finish.curr = finish.first + last_index % CHUNK_SIZE;
+    release_slots(finish.curr + 1, old_back + 1);
+}
+
+// Append n elements from src, copying a chunk at a time
+template <typename T>
+void Deque<T>::append(const T* src, size_t n) {
+    size_t pos = num_elements;
+    extend_back(n);
+    for_each_segment(pos, n, [&](T* data, size_t length) {
+        std::copy(src, src + length, data);
+        src += length;
+        return true;
+    });
+}
+
+// Copy n elements starting at pos into dest, a chunk at a time
+template <typename T>
+void Deque<T>::copy_out(size_t pos, T* dest, size_t n) const {
+    if (pos > num_elements || n > num_elements - pos) {
+        throw std::out_of_range("Deque index out of range");
     }
+    for_each_segment(pos, n, [&](T* data, size_t length) {
+        dest = std::copy(data, data + length, dest);
+        return true;
+    });
 }
@@ -5,22 +5,93 @@
 #include <vector>
 #include <memory>
 #include <limits>
+#include <optional>
+#include <cassert>
 #include <algorithm>
+#include <functional>
+#include <iterator>
+#include <span>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include "Chunk_Pool.h"
+#include "Chunk_Map.h"
 #include "Base_Iterator.h"
 
 template <typename T, bool IsConst, bool IsReverse>
 class BaseIterator;
 
+// On-disk header written by Deque::save and read by Deque::load / MappedDeque
+struct DequeFileHeader {
+    static constexpr uint64_t MAGIC = 0x3145555145445344ULL; // "DSDEQUE1"
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t DATA_OFFSET = 64; // payload starts cache-line aligned
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t element_size;
+    uint64_t count;        // number of stored elements
+    uint64_t chunk_size;   // CHUNK_SIZE of the writer
+    uint64_t checksum;     // FNV-1a over the payload bytes
+};
+
+inline uint64_t deque_checksum(const void* data, size_t bytes, uint64_t hash = 14695981039346656037ULL);
+
+class ByteDeque;
+
+template <typename T>
+struct DequeIO;
+
 template <typename T>
 class Deque {
     private:
         friend class BaseIterator<T, false, false>; 
+        friend class ByteDeque;
+        friend struct DequeIO<T>;
         static constexpr size_t CHUNK_SIZE = 128;   // Fixed chunk size for memory allocation
+        static constexpr size_t PREFETCH_DISTANCE = DEQUE_PREFETCH_DISTANCE; // Chunks prefetched ahead of segment walks
         
         BaseIterator<T, false, false> start;  
         BaseIterator<T, false, false> finish; 
-        std::vector<std::unique_ptr<T[]>> chunk_map; // Stores dynamically allocated chunks
+        ChunkMap<T> chunk_map; // Stores dynamically allocated chunks, with free slots at both ends
+        std::vector<Chunk<T>> spare_front; // Chunks reserved for growth at the front
+        std::vector<Chunk<T>> spare_back;  // Chunks reserved for growth at the back
         size_t num_elements; 
+        ChunkPool<T>* pool; // Source of new chunks, nullptr for plain new[]
+        DestructionPolicy destruction_policy;
+
+        Chunk<T> allocate_chunk();
+        Chunk<T> acquire_front_chunk(); // Reserved chunk if there is one, else a new allocation
+        Chunk<T> acquire_back_chunk();
+        void recycle_last_chunk(std::vector<Chunk<T>>& pool); // Keep the only chunk once the deque empties
+        void park_chunk(Chunk<T>&& chunk, std::vector<Chunk<T>>& spares, T* first, T* last); // Reset, then keep as spare
+        T* element_ptr(size_t pos) const; // Unchecked O(1) lookup of element pos
+        void release_slots(T* first, T* last); // Reset removed elements under the Immediate policy
+        void retire_chunks(size_t first, size_t last); // Release chunk_map[first, last) and erase it
+        void rebind_iterators(size_t front_offset);    // Recompute start/finish from the chunk map
+
+        // Calls f(const T* data, size_t count) for the live part of every chunk, front to back
+        template <typename F>
+        void for_each_segment(F&& f) const;
+        // Calls f(T* data, size_t count) per chunk for [pos, pos + count) until f returns false
+        template <typename F>
+        void for_each_segment(size_t pos, size_t count, F&& f) const;
+        // Calls f(const T* data, size_t count) for the live part of every chunk, back to front
+        template <typename F>
+        void for_each_segment_reverse(F&& f) const;
+        // Calls f(T* data, size_t count) over the next n free slots past the back, in the order
+        // extend_back will use them; the caller must have reserved them with reserve_back
+        template <typename F>
+        void for_each_back_room(size_t n, F&& f) const;
+
+        // Iterator at slot of chunk_map[chunk]; slot may be one outside the chunk for end positions
+        template <bool IsConst, bool IsReverse>
+        BaseIterator<T, IsConst, IsReverse> iterator_at(size_t chunk, std::ptrdiff_t slot) const;
+
+        // Grow by n slots at the back / drop the last n elements, chunk at a time
+        void extend_back(size_t n);
+        void truncate_back(size_t n);
 
     public:
         // Constructors
@@ -38,15 +109,28 @@ class Deque {
         void push_front(const T& val); 
         void pop_back();  
         void pop_front(); 
+        bool try_pop_front(T& out);  
+        bool try_pop_back(T& out);   
+        std::optional<T> try_pop_front(); 
+        std::optional<T> try_pop_back();  
         
         BaseIterator<T, false, false> insert(BaseIterator<T, false, false> pos, const T& val); 
         template <typename... Args>
         BaseIterator<T, false, false> emplace(BaseIterator<T, false, false> pos, Args&&... args); 
+        template <typename Compare = std::less<T>>
+        size_t sorted_insert(const T& val, Compare cmp = Compare()); 
+        template <typename BidirIt, typename Compare = std::less<T>>
+        void merge_sorted(BidirIt first, BidirIt last, Compare cmp = Compare()); 
         void clear();  
         BaseIterator<T, false, false> erase(BaseIterator<T, false, false> pos);
         template <typename... Args>
         void emplace_back(Args&&... args); 
         void resize(size_t new_size, const T& val = T()); 
+        void consume_front(size_t n); 
+        void append(const T* src, size_t n); 
+        void append_deque(Deque<T>&& other);   // Move other's elements to the back, chunk-wise
+        Deque<T> split_at(size_t pos);          // Detach [pos, size()) into a new deque
+        void splice(size_t pos, Deque<T>&& other); // Insert other's elements before pos
         void swap(Deque<T>& other) noexcept; 
 
         // Element access
@@ -58,6 +142,15 @@ class Deque {
         const T& back() const;
         T& operator[](size_t pos); 
         const T& operator[](size_t pos) const;
+        void copy_out(size_t pos, T* dest, size_t n) const;
+
+        // Unchecked hot-path access: the deque must not be empty (asserted in debug builds)
+        T& unchecked_front();
+        const T& unchecked_front() const;
+        T& unchecked_back();
+        const T& unchecked_back() const;
+        void unchecked_pop_front();
+        void unchecked_pop_back();
         
         // Comparison operators
         template <typename U>
@@ -75,19 +168,45 @@ class Deque {
 
         // Iterators
         BaseIterator<T, false, false> begin();  
-        BaseIterator<T, false, true> cbegin() const;
-        BaseIterator<T, true, false> rbegin();  
+        BaseIterator<T, true, false> begin() const;
+        BaseIterator<T, true, false> cbegin() const;
+        BaseIterator<T, false, true> rbegin();  
         BaseIterator<T, true, true> crbegin() const;
         BaseIterator<T, false, false> end();    
-        BaseIterator<T, false, true> cend() const;
-        BaseIterator<T, true, false> rend();    
+        BaseIterator<T, true, false> end() const;
+        BaseIterator<T, true, false> cend() const;
+        BaseIterator<T, false, true> rend();    
         BaseIterator<T, true, true> crend() const;
+
+        // Newest-first traversal: f(const T&) per element, one chunk at a time
+        template <typename F>
+        void for_each_reverse(F&& f) const;
         
         // Capacity
         bool empty() const;  
         size_t size() const; 
         size_t max_size() const; 
         void shrink_to_fit(); 
+        void reserve_front(size_t n); // Room for n push_front calls without allocating
+        void reserve_back(size_t n);  // Room for n push_back calls without allocating
+        size_t capacity_front() const;
+        size_t capacity_back() const;
+
+        // Chunk allocation
+        void use_chunk_pool(ChunkPool<T>* source); // See Chunk_Allocator.h for huge-page slabs
+        void use_heap_allocation();
+
+        // Disposal of removed elements
+        void set_destruction_policy(DestructionPolicy policy);
+        DestructionPolicy get_destruction_policy() const;
+
+        // Byte views of [pos, pos + count) directly over the chunks; iovec export is in Deque_IO.h
+        std::vector<std::span<const std::byte>> export_spans(size_t pos = 0,
+                            size_t count = std::numeric_limits<size_t>::max()) const;
+
+        // Serialization (trivially copyable T only)
+        void save(std::ostream& out) const;
+        void load(std::istream& in);
 };
 
 #include "Deque.cpp" 
@@ -0,0 +1,149 @@
+#include "Deque_IO.h"
+
+template <typename T>
+size_t DequeIO<T>::export_iovec(const Deque<T>& deque, iovec* out, size_t max_iov, size_t pos, size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>, "export_iovec requires a trivially copyable T");
+    size_t filled = 0;
+    if (max_iov == 0) {
+        return 0;
+    }
+    deque.for_each_segment(pos, count, [&](T* data, size_t length) {
+        out[filled].iov_base = data;
+        out[filled].iov_len = length * sizeof(T);
+        return ++filled < max_iov;
+    });
+    return filled;
+}
+
+// Same layout as the stream version; the chunks go out through writev in batches
+template <typename T>
+void DequeIO<T>::save(const Deque<T>& deque, int fd) {
+    static_assert(std::is_trivially_copyable_v<T>, "Deque save requires a trivially copyable T");
+    static constexpr size_t MAX_IOV = 1024;
+    DequeFileHeader header{DequeFileHeader::MAGIC, DequeFileHeader::VERSION, sizeof(T), 0, Deque<T>::CHUNK_SIZE, 0};
+    header.checksum = deque_checksum(nullptr, 0);
+    deque.for_each_segment([&](const T* data, size_t count) {
+        header.count += count;
+        header.checksum = deque_checksum(data, count * sizeof(T), header.checksum);
+    });
+    char block[DequeFileHeader::DATA_OFFSET] = {};
+    std::memcpy(block, &header, sizeof(header));
+
+    std::vector<iovec> iov;
+    iov.reserve(std::min(deque.chunk_map.size() + 1, MAX_IOV));
+    iov.push_back({block, sizeof(block)});
+    auto flush = [&]() {
+        size_t index = 0;
+        while (index < iov.size()) {
+            ssize_t written = ::writev(fd, iov.data() + index, static_cast<int>(iov.size() - index));
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error("Failed to write deque");
+            }
+            // Skip over fully written buffers and trim a partially written one
+            size_t n = static_cast<size_t>(written);
+            while (index < iov.size() && n >= iov[index].iov_len) {
+                n -= iov[index].iov_len;
+                ++index;
+            }
+            if (index < iov.size()) {
+                iov[index].iov_base = static_cast<char*>(iov[index].iov_base) + n;
+                iov[index].iov_len -= n;
+            }
+        }
+        iov.clear();
+    };
+    deque.for_each_segment([&](const T* data, size_t count) {
+        iov.push_back({const_cast<T*>(data), count * sizeof(T)});
+        if (iov.size() == MAX_IOV) {
+            flush();
+        }
+    });
+    flush();
+}
+
+template <typename T>
+void DequeIO<T>::load(Deque<T>& deque, int fd) {
+    static_assert(std::is_trivially_copyable_v<T>, "Deque load requires a trivially copyable T");
+    static constexpr size_t MAX_IOV = 1024;
+    static constexpr size_t CHUNK_SIZE = Deque<T>::CHUNK_SIZE;
+    auto read_fully = [fd](iovec* iov, size_t iov_count) {
+        size_t index = 0;
+        while (index < iov_count) {
+            ssize_t got = ::readv(fd, iov + index, static_cast<int>(iov_count - index));
+            if (got < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            if (got == 0) {
+                return false;
+            }
+            size_t n = static_cast<size_t>(got);
+            while (index < iov_count && n >= iov[index].iov_len) {
+                n -= iov[index].iov_len;
+                ++index;
+            }
+            if (index < iov_count) {
+                iov[index].iov_base = static_cast<char*>(iov[index].iov_base) + n;
+                iov[index].iov_len -= n;
+            }
+        }
+        return true;
+    };
+
+    char block[DequeFileHeader::DATA_OFFSET];
+    iovec header_iov{block, sizeof(block)};
+    if (!read_fully(&header_iov, 1)) {
+        throw std::runtime_error("Failed to read deque header");
+    }
+    DequeFileHeader header;
+    std::memcpy(&header, block, sizeof(header));
+    if (header.magic != DequeFileHeader::MAGIC || header.version != DequeFileHeader::VERSION ||
+        header.element_size != sizeof(T)) {
+        throw std::runtime_error("Incompatible deque file");
+    }
+    deque.clear();
+    size_t num_chunks = (header.count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    deque.chunk_map.reserve(num_chunks);
+    std::vector<iovec> iov;
+    iov.reserve(std::min(num_chunks, MAX_IOV));
+    size_t remaining = header.count;
+    while (remaining > 0) {
+        size_t count = std::min(remaining, CHUNK_SIZE);
+        deque.chunk_map.push_back(deque.allocate_chunk());
+        iov.push_back({deque.chunk_map.back().get(), count * sizeof(T)});
+        remaining -= count;
+        if (iov.size() == MAX_IOV || remaining == 0) {
+            if (!read_fully(iov.data(), iov.size())) {
+                deque.clear();
+                throw std::runtime_error("Truncated deque payload");
+            }
+            iov.clear();
+        }
+    }
+    deque.num_elements = header.count;
+    deque.rebind_iterators(0);
+    uint64_t checksum = deque_checksum(nullptr, 0);
+    deque.for_each_segment([&](const T* data, size_t count) {
+        checksum = deque_checksum(data, count * sizeof(T), checksum);
+    });
+    if (checksum != header.checksum) {
+        deque.clear();
+        throw std::runtime_error("Deque checksum mismatch");
+    }
+}
+
+template <typename T>
+size_t export_iovec(const Deque<T>& deque, iovec* out, size_t max_iov, size_t pos, size_t count) {
+    return DequeIO<T>::export_iovec(deque, out, max_iov, pos, count);
+}
+
+template <typename T>
+void save(const Deque<T>& deque, int fd) {
+    DequeIO<T>::save(deque, fd);
+}
+
+template <typename T>
+void load(Deque<T>& deque, int fd) {
+    DequeIO<T>::load(deque, fd);
+}
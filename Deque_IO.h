@@ -0,0 +1,32 @@
+#ifndef DEQUE_IO_H
+#define DEQUE_IO_H
+
+#include <cerrno>
+#include <cstddef>
+#include <limits>
+#include <sys/uio.h>
+#include <unistd.h>
+#include "Deque.h"
+
+// POSIX I/O for Deque: scatter-gather export and fd serialization straight
+// over the chunks. Kept out of Deque.h so the container itself stays portable.
+template <typename T>
+struct DequeIO {
+    static size_t export_iovec(const Deque<T>& deque, iovec* out, size_t max_iov, size_t pos, size_t count);
+    static void save(const Deque<T>& deque, int fd);
+    static void load(Deque<T>& deque, int fd);
+};
+
+// Fill up to max_iov iovecs covering [pos, pos + count), one per chunk touched
+template <typename T>
+size_t export_iovec(const Deque<T>& deque, iovec* out, size_t max_iov, size_t pos = 0,
+                    size_t count = std::numeric_limits<size_t>::max());
+
+// Same file layout as Deque::save(std::ostream&), written and read with writev/readv
+template <typename T>
+void save(const Deque<T>& deque, int fd);
+template <typename T>
+void load(Deque<T>& deque, int fd);
+
+#include "Deque_IO.cpp"
+#endif //DEQUE_IO_H
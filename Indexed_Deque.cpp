@@ -0,0 +1,201 @@
+#include "Indexed_Deque.h"
+#include <stdexcept>
+#include <utility>
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+IndexedDeque<K, T, Hash, KeyEqual>::IndexedDeque()
+    : slots{}, base{0}, index(MIN_INDEX, EMPTY), index_used{0}, live{0}, hash{}, equal{} {}
+
+// Fibonacci hashing spreads weak hashes such as the identity hash of integers
+template <typename K, typename T, typename Hash, typename KeyEqual>
+size_t IndexedDeque<K, T, Hash, KeyEqual>::probe_start(const K& key) const {
+    uint64_t mixed = static_cast<uint64_t>(hash(key)) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(mixed >> 32) & (index.size() - 1);
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+size_t IndexedDeque<K, T, Hash, KeyEqual>::find_entry(const K& key) const {
+    size_t mask = index.size() - 1;
+    for (size_t pos = probe_start(key);; pos = (pos + 1) & mask) {
+        uint64_t seq = index[pos];
+        if (seq == EMPTY) {
+            return NPOS;
+        }
+        if (seq != TOMBSTONE && equal(slots[seq - base].key, key)) {
+            return pos;
+        }
+    }
+}
+
+// Place seq in the first free entry of key's probe sequence; the key must be absent
+template <typename K, typename T, typename Hash, typename KeyEqual>
+void IndexedDeque<K, T, Hash, KeyEqual>::index_insert(const K& key, uint64_t seq) {
+    size_t mask = index.size() - 1;
+    size_t pos = probe_start(key);
+    while (index[pos] != EMPTY && index[pos] != TOMBSTONE) {
+        pos = (pos + 1) & mask;
+    }
+    if (index[pos] == EMPTY) {
+        ++index_used;
+    }
+    index[pos] = seq;
+}
+
+// Rebuild the index at the given power-of-two capacity, dropping its tombstones
+template <typename K, typename T, typename Hash, typename KeyEqual>
+void IndexedDeque<K, T, Hash, KeyEqual>::rehash(size_t capacity) {
+    index.assign(capacity, EMPTY);
+    index_used = 0;
+    for (size_t i = 0; i < slots.size(); ++i) {
+        if (slots[i].live) {
+            index_insert(slots[i].key, base + i);
+        }
+    }
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+void IndexedDeque<K, T, Hash, KeyEqual>::trim() {
+    while (!slots.empty() && !slots.unchecked_front().live) {
+        slots.unchecked_pop_front();
+        ++base;
+    }
+    while (!slots.empty() && !slots.unchecked_back().live) {
+        slots.unchecked_pop_back();
+    }
+}
+
+// Copy the live slots into fresh chunks once dead slots outnumber them.
+// Sequence numbers change, so the index is rebuilt; both costs are paid for by
+// the cancellations that created the dead slots.
+template <typename K, typename T, typename Hash, typename KeyEqual>
+void IndexedDeque<K, T, Hash, KeyEqual>::compact() {
+    size_t dead = slots.size() - live;
+    if (dead < MIN_DEAD_FOR_COMPACTION || dead <= live) {
+        return;
+    }
+    Deque<Slot> packed;
+    packed.reserve_back(live);
+    for (size_t i = 0; i < slots.size(); ++i) {
+        if (slots[i].live) {
+            packed.emplace_back(std::move(slots[i]));
+        }
+    }
+    slots.swap(packed);
+    base = 0;
+    rehash(index.size());
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+bool IndexedDeque<K, T, Hash, KeyEqual>::push_back(const K& key, const T& value) {
+    if (find_entry(key) != NPOS) {
+        return false;
+    }
+    // Keep the table at most 3/4 full counting tombstones; grow only if live keys need it
+    if ((index_used + 1) * 4 > index.size() * 3) {
+        rehash((live + 1) * 2 > index.size() ? index.size() * 2 : index.size());
+    }
+    index_insert(key, base + slots.size());
+    slots.emplace_back(Slot{key, value, true});
+    ++live;
+    return true;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+void IndexedDeque<K, T, Hash, KeyEqual>::pop_front() {
+    if (live == 0) {
+        throw std::out_of_range("Cannot pop from an empty deque");
+    }
+    index[find_entry(slots.unchecked_front().key)] = TOMBSTONE;
+    slots.unchecked_pop_front();
+    ++base;
+    --live;
+    trim();
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+bool IndexedDeque<K, T, Hash, KeyEqual>::cancel(const K& key) {
+    size_t pos = find_entry(key);
+    if (pos == NPOS) {
+        return false;
+    }
+    Slot& slot = slots[index[pos] - base];
+    index[pos] = TOMBSTONE;
+    // Drop what the entry owns now rather than when its chunk goes away
+    slot = Slot{};
+    --live;
+    trim();
+    compact();
+    return true;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+void IndexedDeque<K, T, Hash, KeyEqual>::clear() {
+    slots.clear();
+    base = 0;
+    live = 0;
+    index.assign(MIN_INDEX, EMPTY);
+    index_used = 0;
+}
+
+// The front slot is always live because dead slots are trimmed from the ends
+template <typename K, typename T, typename Hash, typename KeyEqual>
+T& IndexedDeque<K, T, Hash, KeyEqual>::front() {
+    if (live == 0) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return slots.unchecked_front().value;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+const T& IndexedDeque<K, T, Hash, KeyEqual>::front() const {
+    if (live == 0) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return slots.unchecked_front().value;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+const K& IndexedDeque<K, T, Hash, KeyEqual>::front_key() const {
+    if (live == 0) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return slots.unchecked_front().key;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+T* IndexedDeque<K, T, Hash, KeyEqual>::find(const K& key) {
+    size_t pos = find_entry(key);
+    return pos == NPOS ? nullptr : &slots[index[pos] - base].value;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+const T* IndexedDeque<K, T, Hash, KeyEqual>::find(const K& key) const {
+    size_t pos = find_entry(key);
+    return pos == NPOS ? nullptr : &slots[index[pos] - base].value;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+bool IndexedDeque<K, T, Hash, KeyEqual>::contains(const K& key) const {
+    return find_entry(key) != NPOS;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+template <typename F>
+void IndexedDeque<K, T, Hash, KeyEqual>::for_each(F&& f) const {
+    for (size_t i = 0; i < slots.size(); ++i) {
+        const Slot& slot = slots[i];
+        if (slot.live) {
+            f(slot.key, slot.value);
+        }
+    }
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+bool IndexedDeque<K, T, Hash, KeyEqual>::empty() const {
+    return live == 0;
+}
+
+template <typename K, typename T, typename Hash, typename KeyEqual>
+size_t IndexedDeque<K, T, Hash, KeyEqual>::size() const {
+    return live;
+}
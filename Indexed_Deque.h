@@ -0,0 +1,76 @@
+#ifndef INDEXED_DEQUE_H
+#define INDEXED_DEQUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+#include "Deque.h"
+
+// FIFO queue of keyed entries that can also be found or cancelled by key in O(1).
+//
+// Entries live in a Deque of slots addressed by a sequence number that never
+// changes while the entry is queued; an open-addressing hash table maps each key
+// to its sequence number. Cancelling leaves a dead slot behind instead of
+// shifting the storage. Dead slots at either end are dropped immediately, and
+// the storage is compacted once dead slots outnumber live ones.
+template <typename K, typename T, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class IndexedDeque {
+    private:
+        static constexpr size_t MIN_DEAD_FOR_COMPACTION = 128; // Dead slots tolerated before compaction is considered
+        static constexpr size_t MIN_INDEX = 16;
+        static constexpr uint64_t EMPTY = std::numeric_limits<uint64_t>::max();
+        static constexpr uint64_t TOMBSTONE = EMPTY - 1;
+        static constexpr size_t NPOS = std::numeric_limits<size_t>::max();
+
+        struct Slot {
+            K key;
+            T value;
+            bool live = false;
+        };
+
+        Deque<Slot> slots;
+        uint64_t base;                 // Sequence number of slots[0]
+        std::vector<uint64_t> index;   // Sequence numbers, EMPTY or TOMBSTONE; power-of-two size
+        size_t index_used;             // Entries that are not EMPTY
+        size_t live;
+        Hash hash;
+        KeyEqual equal;
+
+        size_t probe_start(const K& key) const;
+        size_t find_entry(const K& key) const;        // Index position of key, NPOS if absent
+        void index_insert(const K& key, uint64_t seq);
+        void rehash(size_t capacity);
+        void trim();      // Drop dead slots at both ends
+        void compact();   // Squeeze out dead slots once they dominate
+
+    public:
+        // Constructors
+        IndexedDeque();
+
+        // Modifiers
+        bool push_back(const K& key, const T& value); // False if key is already queued
+        void pop_front();
+        bool cancel(const K& key);                    // Remove by key, false if absent
+        void clear();
+
+        // Element access
+        T& front();
+        const T& front() const;
+        const K& front_key() const;
+        T* find(const K& key);
+        const T* find(const K& key) const;
+        bool contains(const K& key) const;
+
+        // Calls f(const K& key, const T& value) for every queued entry, front to back
+        template <typename F>
+        void for_each(F&& f) const;
+
+        // Capacity
+        bool empty() const;
+        size_t size() const;
+};
+
+#include "Indexed_Deque.cpp"
+#endif //INDEXED_DEQUE_H
@@ -0,0 +1,162 @@
+#include "Mapped_Deque.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Map the file and validate its header
+template <typename T>
+MappedDeque<T>::MappedDeque(const std::string& path)
+    : mapping{nullptr}, mapping_size{0}, elements{nullptr}, num_elements{0}, chunk_size{0}, checksum{0} {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < DequeFileHeader::DATA_OFFSET) {
+        ::close(fd);
+        throw std::runtime_error("Not a deque file: " + path);
+    }
+    mapping_size = static_cast<size_t>(st.st_size);
+    mapping = ::mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        throw std::runtime_error("Cannot map " + path);
+    }
+
+    DequeFileHeader header;
+    std::memcpy(&header, mapping, sizeof(header));
+    if (header.magic != DequeFileHeader::MAGIC || header.version != DequeFileHeader::VERSION ||
+        header.element_size != sizeof(T) || header.chunk_size == 0 ||
+        header.count > (mapping_size - DequeFileHeader::DATA_OFFSET) / sizeof(T)) {
+        unmap();
+        throw std::runtime_error("Incompatible deque file: " + path);
+    }
+    elements = reinterpret_cast<const T*>(static_cast<const char*>(mapping) + DequeFileHeader::DATA_OFFSET);
+    num_elements = header.count;
+    chunk_size = header.chunk_size;
+    checksum = header.checksum;
+    ::madvise(mapping, mapping_size, MADV_SEQUENTIAL);
+}
+
+template <typename T>
+MappedDeque<T>::MappedDeque(MappedDeque&& other) noexcept
+    : mapping{other.mapping}, mapping_size{other.mapping_size}, elements{other.elements},
+      num_elements{other.num_elements}, chunk_size{other.chunk_size}, checksum{other.checksum} {
+    other.mapping = nullptr;
+    other.mapping_size = 0;
+    other.elements = nullptr;
+    other.num_elements = 0;
+}
+
+template <typename T>
+MappedDeque<T>::~MappedDeque() {
+    unmap();
+}
+
+template <typename T>
+MappedDeque<T>& MappedDeque<T>::operator=(MappedDeque&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        mapping = other.mapping;
+        mapping_size = other.mapping_size;
+        elements = other.elements;
+        num_elements = other.num_elements;
+        chunk_size = other.chunk_size;
+        checksum = other.checksum;
+        other.mapping = nullptr;
+        other.mapping_size = 0;
+        other.elements = nullptr;
+        other.num_elements = 0;
+    }
+    return *this;
+}
+
+template <typename T>
+void MappedDeque<T>::unmap() noexcept {
+    if (mapping) {
+        ::munmap(mapping, mapping_size);
+        mapping = nullptr;
+    }
+}
+
+// Access element at pos with bounds checking
+template <typename T>
+const T& MappedDeque<T>::at(size_t pos) const {
+    if (pos >= num_elements) {
+        throw std::out_of_range("MappedDeque index out of range");
+    }
+    return elements[pos];
+}
+
+template <typename T>
+const T& MappedDeque<T>::operator[](size_t pos) const {
+    return at(pos);
+}
+
+template <typename T>
+const T& MappedDeque<T>::front() const {
+    if (num_elements == 0) {
+        throw std::out_of_range("MappedDeque is empty");
+    }
+    return elements[0];
+}
+
+template <typename T>
+const T& MappedDeque<T>::back() const {
+    if (num_elements == 0) {
+        throw std::out_of_range("MappedDeque is empty");
+    }
+    return elements[num_elements - 1];
+}
+
+template <typename T>
+const T* MappedDeque<T>::data() const {
+    return elements;
+}
+
+template <typename T>
+size_t MappedDeque<T>::chunk_count() const {
+    return (num_elements + chunk_size - 1) / chunk_size;
+}
+
+template <typename T>
+const T* MappedDeque<T>::chunk(size_t i) const {
+    if (i >= chunk_count()) {
+        throw std::out_of_range("MappedDeque chunk index out of range");
+    }
+    return elements + i * chunk_size;
+}
+
+template <typename T>
+size_t MappedDeque<T>::chunk_length(size_t i) const {
+    if (i >= chunk_count()) {
+        throw std::out_of_range("MappedDeque chunk index out of range");
+    }
+    return std::min(chunk_size, num_elements - i * chunk_size);
+}
+
+template <typename T>
+const T* MappedDeque<T>::begin() const {
+    return elements;
+}
+
+template <typename T>
+const T* MappedDeque<T>::end() const {
+    return elements + num_elements;
+}
+
+template <typename T>
+bool MappedDeque<T>::empty() const {
+    return num_elements == 0;
+}
+
+template <typename T>
+size_t MappedDeque<T>::size() const {
+    return num_elements;
+}
+
+template <typename T>
+bool MappedDeque<T>::verify() const {
+    return deque_checksum(elements, num_elements * sizeof(T)) == checksum;
+}
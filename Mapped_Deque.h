@@ -0,0 +1,60 @@
+#ifndef MAPPED_DEQUE_H
+#define MAPPED_DEQUE_H
+
+#include <string>
+#include <cstddef>
+#include "Deque_IO.h"
+
+// Read-only view over a file written by Deque<T>::save or save(deque, fd).
+// The payload is mapped with mmap and iterated in place, nothing is copied.
+template <typename T>
+class MappedDeque {
+    private:
+        static_assert(std::is_trivially_copyable_v<T>, "MappedDeque requires a trivially copyable T");
+
+        void* mapping;          // Whole file mapping
+        size_t mapping_size;
+        const T* elements;      // First element of the payload inside the mapping
+        size_t num_elements;
+        size_t chunk_size;      // Chunk size of the deque that wrote the file
+        uint64_t checksum;
+
+        void unmap() noexcept;
+
+    public:
+        // Constructors
+        explicit MappedDeque(const std::string& path);
+        MappedDeque(const MappedDeque&) = delete;
+        MappedDeque(MappedDeque&& other) noexcept;
+        ~MappedDeque();
+
+        // Assignment operators
+        MappedDeque& operator=(const MappedDeque&) = delete;
+        MappedDeque& operator=(MappedDeque&& other) noexcept;
+
+        // Element access
+        const T& at(size_t pos) const;
+        const T& operator[](size_t pos) const;
+        const T& front() const;
+        const T& back() const;
+        const T* data() const;
+
+        // Chunk access: chunk i covers [chunk(i), chunk(i) + chunk_length(i))
+        size_t chunk_count() const;
+        const T* chunk(size_t i) const;
+        size_t chunk_length(size_t i) const;
+
+        // Iterators
+        const T* begin() const;
+        const T* end() const;
+
+        // Capacity
+        bool empty() const;
+        size_t size() const;
+
+        // Recompute the payload checksum and compare it with the header
+        bool verify() const;
+};
+
+#include "Mapped_Deque.cpp"
+#endif //MAPPED_DEQUE_H
@@ -0,0 +1,315 @@
+#include "Persistent_Deque.h"
+
+template <typename T>
+PersistentDeque<T>::PersistentDeque()
+    : front_leaf{}, front_len{0}, middle{}, back_leaf{}, back_len{0} {}
+
+template <typename T>
+PersistentDeque<T>::PersistentDeque(LeafPtr _front_leaf, size_t _front_len, NodePtr _middle,
+                                    LeafPtr _back_leaf, size_t _back_len)
+    : front_leaf{std::move(_front_leaf)}, front_len{_front_len}, middle{std::move(_middle)},
+      back_leaf{std::move(_back_leaf)}, back_len{_back_len} {}
+
+// Return a leaf holding the first len slots of leaf followed by val.
+// Writes in place when this version owns the end of the leaf, copies otherwise.
+template <typename T>
+typename PersistentDeque<T>::LeafPtr PersistentDeque<T>::append_to(const LeafPtr& leaf, size_t len, const T& val) {
+    if (leaf) {
+        size_t expected = len;
+        if (leaf->filled.compare_exchange_strong(expected, len + 1)) {
+            leaf->data[len] = val;
+            return leaf;
+        }
+    }
+    LeafPtr copy = std::make_shared<Leaf>();
+    for (size_t i = 0; i < len; ++i) {
+        copy->data[i] = leaf->data[i];
+    }
+    copy->data[len] = val;
+    copy->filled.store(len + 1);
+    return copy;
+}
+
+// New leaf with leaf->data[from, to) in reverse order
+template <typename T>
+typename PersistentDeque<T>::LeafPtr PersistentDeque<T>::reversed_copy(const LeafPtr& leaf, size_t from, size_t to) {
+    LeafPtr copy = std::make_shared<Leaf>();
+    size_t out = 0;
+    for (size_t i = to; i > from; --i) {
+        copy->data[out++] = leaf->data[i - 1];
+    }
+    copy->filled.store(out);
+    return copy;
+}
+
+template <typename T>
+size_t PersistentDeque<T>::count_of(const NodePtr& node) {
+    return node ? node->count : 0;
+}
+
+template <typename T>
+int PersistentDeque<T>::height_of(const NodePtr& node) {
+    return node ? node->height : 0;
+}
+
+template <typename T>
+typename PersistentDeque<T>::NodePtr PersistentDeque<T>::make_node(NodePtr left, LeafPtr leaf, NodePtr right) {
+    size_t count = count_of(left) + 1 + count_of(right);
+    int height = std::max(height_of(left), height_of(right)) + 1;
+    return std::make_shared<const Node>(Node{std::move(left), std::move(leaf), std::move(right), count, height});
+}
+
+// Build a node from subtrees whose heights differ by at most two, rotating as needed
+template <typename T>
+typename PersistentDeque<T>::NodePtr PersistentDeque<T>::balance(NodePtr left, LeafPtr leaf, NodePtr right) {
+    int lh = height_of(left);
+    int rh = height_of(right);
+    if (lh > rh + 1) {
+        if (height_of(left->left) >= height_of(left->right)) {
+            return make_node(left->left, left->leaf, make_node(left->right, std::move(leaf), std::move(right)));
+        }
+        const NodePtr& pivot = left->right;
+        return make_node(make_node(left->left, left->leaf, pivot->left), pivot->leaf,
+                         make_node(pivot->right, std::move(leaf), std::move(right)));
+    }
+    if (rh > lh + 1) {
+        if (height_of(right->right) >= height_of(right->left)) {
+            return make_node(make_node(std::move(left), std::move(leaf), right->left), right->leaf, right->right);
+        }
+        const NodePtr& pivot = right->left;
+        return make_node(make_node(std::move(left), std::move(leaf), pivot->left), pivot->leaf,
+                         make_node(pivot->right, right->leaf, right->right));
+    }
+    return make_node(std::move(left), std::move(leaf), std::move(right));
+}
+
+template <typename T>
+typename PersistentDeque<T>::NodePtr PersistentDeque<T>::push_leftmost(const NodePtr& node, LeafPtr leaf) {
+    if (!node) {
+        return make_node(nullptr, std::move(leaf), nullptr);
+    }
+    return balance(push_leftmost(node->left, std::move(leaf)), node->leaf, node->right);
+}
+
+template <typename T>
+typename PersistentDeque<T>::NodePtr PersistentDeque<T>::push_rightmost(const NodePtr& node, LeafPtr leaf) {
+    if (!node) {
+        return make_node(nullptr, std::move(leaf), nullptr);
+    }
+    return balance(node->left, node->leaf, push_rightmost(node->right, std::move(leaf)));
+}
+
+template <typename T>
+typename PersistentDeque<T>::NodePtr PersistentDeque<T>::pop_leftmost(const NodePtr& node, LeafPtr& out) {
+    if (!node->left) {
+        out = node->leaf;
+        return node->right;
+    }
+    return balance(pop_leftmost(node->left, out), node->leaf, node->right);
+}
+
+template <typename T>
+typename PersistentDeque<T>::NodePtr PersistentDeque<T>::pop_rightmost(const NodePtr& node, LeafPtr& out) {
+    if (!node->right) {
+        out = node->leaf;
+        return node->left;
+    }
+    return balance(node->left, node->leaf, pop_rightmost(node->right, out));
+}
+
+// Leaf at in-order position index
+template <typename T>
+const typename PersistentDeque<T>::Leaf& PersistentDeque<T>::leaf_at(const NodePtr& node, size_t index) {
+    const Node* current = node.get();
+    for (;;) {
+        size_t left_count = count_of(current->left);
+        if (index < left_count) {
+            current = current->left.get();
+        } else if (index == left_count) {
+            return *current->leaf;
+        } else {
+            index -= left_count + 1;
+            current = current->right.get();
+        }
+    }
+}
+
+template <typename T>
+template <typename F>
+void PersistentDeque<T>::for_each_leaf(const NodePtr& node, F& f) {
+    if (!node) {
+        return;
+    }
+    for_each_leaf(node->left, f);
+    f(*node->leaf);
+    for_each_leaf(node->right, f);
+}
+
+// Add an element to the back; a full back buffer moves into the tree
+template <typename T>
+PersistentDeque<T> PersistentDeque<T>::push_back(const T& val) const {
+    if (back_len == CHUNK_SIZE) {
+        return PersistentDeque(front_leaf, front_len, push_rightmost(middle, back_leaf),
+                               append_to(nullptr, 0, val), 1);
+    }
+    return PersistentDeque(front_leaf, front_len, middle, append_to(back_leaf, back_len, val), back_len + 1);
+}
+
+// Add an element to the front; a full front buffer is put in order and moves into the tree
+template <typename T>
+PersistentDeque<T> PersistentDeque<T>::push_front(const T& val) const {
+    if (front_len == CHUNK_SIZE) {
+        return PersistentDeque(append_to(nullptr, 0, val), 1,
+                               push_leftmost(middle, reversed_copy(front_leaf, 0, CHUNK_SIZE)),
+                               back_leaf, back_len);
+    }
+    return PersistentDeque(append_to(front_leaf, front_len, val), front_len + 1, middle, back_leaf, back_len);
+}
+
+// Remove the last element, refilling the back buffer from the tree or the front buffer
+template <typename T>
+PersistentDeque<T> PersistentDeque<T>::pop_back() const {
+    if (back_len > 0) {
+        return PersistentDeque(front_leaf, front_len, middle, back_len > 1 ? back_leaf : nullptr, back_len - 1);
+    }
+    if (middle) {
+        LeafPtr leaf;
+        NodePtr rest = pop_rightmost(middle, leaf);
+        return PersistentDeque(front_leaf, front_len, std::move(rest), std::move(leaf), CHUNK_SIZE - 1);
+    }
+    if (front_len == 0) {
+        throw std::out_of_range("Cannot pop from an empty deque");
+    }
+    // Only the front buffer is left; its last element is data[0]
+    if (front_len == 1) {
+        return PersistentDeque();
+    }
+    return PersistentDeque(nullptr, 0, nullptr, reversed_copy(front_leaf, 1, front_len), front_len - 1);
+}
+
+// Remove the first element, refilling the front buffer from the tree or the back buffer
+template <typename T>
+PersistentDeque<T> PersistentDeque<T>::pop_front() const {
+    if (front_len > 0) {
+        return PersistentDeque(front_len > 1 ? front_leaf : nullptr, front_len - 1, middle, back_leaf, back_len);
+    }
+    if (middle) {
+        LeafPtr leaf;
+        NodePtr rest = pop_leftmost(middle, leaf);
+        return PersistentDeque(reversed_copy(leaf, 1, CHUNK_SIZE), CHUNK_SIZE - 1, std::move(rest), back_leaf, back_len);
+    }
+    if (back_len == 0) {
+        throw std::out_of_range("Cannot pop from an empty deque");
+    }
+    if (back_len == 1) {
+        return PersistentDeque();
+    }
+    return PersistentDeque(reversed_copy(back_leaf, 1, back_len), back_len - 1, nullptr, nullptr, 0);
+}
+
+// Replace element pos, copying only the chunk and tree path that hold it
+template <typename T>
+PersistentDeque<T> PersistentDeque<T>::set(size_t pos, const T& val) const {
+    if (pos >= size()) {
+        throw std::out_of_range("Deque index out of range");
+    }
+    auto copy_leaf = [](const Leaf& leaf, size_t len) {
+        LeafPtr copy = std::make_shared<Leaf>();
+        for (size_t i = 0; i < len; ++i) {
+            copy->data[i] = leaf.data[i];
+        }
+        copy->filled.store(len);
+        return copy;
+    };
+    if (pos < front_len) {
+        LeafPtr leaf = copy_leaf(*front_leaf, front_len);
+        leaf->data[front_len - 1 - pos] = val;
+        return PersistentDeque(std::move(leaf), front_len, middle, back_leaf, back_len);
+    }
+    pos -= front_len;
+    size_t middle_size = count_of(middle) * CHUNK_SIZE;
+    if (pos >= middle_size) {
+        LeafPtr leaf = copy_leaf(*back_leaf, back_len);
+        leaf->data[pos - middle_size] = val;
+        return PersistentDeque(front_leaf, front_len, middle, std::move(leaf), back_len);
+    }
+    // Rebuild the root-to-leaf path
+    auto rebuild = [&](auto& self, const NodePtr& node, size_t index) -> NodePtr {
+        size_t left_count = count_of(node->left);
+        if (index < left_count) {
+            return make_node(self(self, node->left, index), node->leaf, node->right);
+        }
+        if (index > left_count) {
+            return make_node(node->left, node->leaf, self(self, node->right, index - left_count - 1));
+        }
+        LeafPtr leaf = copy_leaf(*node->leaf, CHUNK_SIZE);
+        leaf->data[pos % CHUNK_SIZE] = val;
+        return make_node(node->left, std::move(leaf), node->right);
+    };
+    return PersistentDeque(front_leaf, front_len, rebuild(rebuild, middle, pos / CHUNK_SIZE), back_leaf, back_len);
+}
+
+// Access element at pos with bounds checking
+template <typename T>
+const T& PersistentDeque<T>::at(size_t pos) const {
+    if (pos >= size()) {
+        throw std::out_of_range("Deque index out of range");
+    }
+    if (pos < front_len) {
+        return front_leaf->data[front_len - 1 - pos];
+    }
+    pos -= front_len;
+    size_t middle_size = count_of(middle) * CHUNK_SIZE;
+    if (pos < middle_size) {
+        return leaf_at(middle, pos / CHUNK_SIZE).data[pos % CHUNK_SIZE];
+    }
+    return back_leaf->data[pos - middle_size];
+}
+
+template <typename T>
+const T& PersistentDeque<T>::operator[](size_t pos) const {
+    return at(pos);
+}
+
+template <typename T>
+const T& PersistentDeque<T>::front() const {
+    if (empty()) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return at(0);
+}
+
+template <typename T>
+const T& PersistentDeque<T>::back() const {
+    if (empty()) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return at(size() - 1);
+}
+
+template <typename T>
+template <typename F>
+void PersistentDeque<T>::for_each(F&& f) const {
+    for (size_t i = front_len; i > 0; --i) {
+        f(static_cast<const T&>(front_leaf->data[i - 1]));
+    }
+    auto visit = [&f](const Leaf& leaf) {
+        for (size_t i = 0; i < CHUNK_SIZE; ++i) {
+            f(static_cast<const T&>(leaf.data[i]));
+        }
+    };
+    for_each_leaf(middle, visit);
+    for (size_t i = 0; i < back_len; ++i) {
+        f(static_cast<const T&>(back_leaf->data[i]));
+    }
+}
+
+template <typename T>
+bool PersistentDeque<T>::empty() const {
+    return size() == 0;
+}
+
+template <typename T>
+size_t PersistentDeque<T>::size() const {
+    return front_len + count_of(middle) * CHUNK_SIZE + back_len;
+}
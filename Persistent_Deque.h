@@ -0,0 +1,94 @@
+#ifndef PERSISTENT_DEQUE_H
+#define PERSISTENT_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+// Immutable deque whose versions share structure. Every modifier returns a new
+// version and leaves the old one valid.
+//
+// Layout: a front buffer chunk (stored reversed), a balanced tree of full
+// chunks in the middle, and a back buffer chunk. Pushes write into the buffer
+// chunk in place when no other version has claimed the next slot, so push and
+// pop at either end are O(1) amortized; only every CHUNK_SIZE-th operation
+// touches the tree in O(log n). Indexing is O(log n).
+template <typename T>
+class PersistentDeque {
+    private:
+        static constexpr size_t CHUNK_SIZE = 128;   // Elements per chunk
+
+        // Fixed-size chunk. Slots below filled are owned by some version and never change;
+        // a version ending exactly at filled may claim the next slot and write it in place.
+        struct Leaf {
+            T data[CHUNK_SIZE];
+            std::atomic<size_t> filled{0};
+        };
+        using LeafPtr = std::shared_ptr<Leaf>;
+
+        // Node of a persistent AVL tree of full leaves, ordered front to back
+        struct Node;
+        using NodePtr = std::shared_ptr<const Node>;
+        struct Node {
+            NodePtr left;
+            LeafPtr leaf;
+            NodePtr right;
+            size_t count; // Leaves in this subtree
+            int height;
+        };
+
+        LeafPtr front_leaf;   // Front elements, data[0] is the one closest to the middle
+        size_t front_len;
+        NodePtr middle;
+        LeafPtr back_leaf;    // Back elements in order
+        size_t back_len;
+
+        PersistentDeque(LeafPtr _front_leaf, size_t _front_len, NodePtr _middle, LeafPtr _back_leaf, size_t _back_len);
+
+        // Buffer helpers
+        static LeafPtr append_to(const LeafPtr& leaf, size_t len, const T& val);
+        static LeafPtr reversed_copy(const LeafPtr& leaf, size_t from, size_t to);
+
+        // Tree helpers (path copying)
+        static size_t count_of(const NodePtr& node);
+        static int height_of(const NodePtr& node);
+        static NodePtr make_node(NodePtr left, LeafPtr leaf, NodePtr right);
+        static NodePtr balance(NodePtr left, LeafPtr leaf, NodePtr right);
+        static NodePtr push_leftmost(const NodePtr& node, LeafPtr leaf);
+        static NodePtr push_rightmost(const NodePtr& node, LeafPtr leaf);
+        static NodePtr pop_leftmost(const NodePtr& node, LeafPtr& out);
+        static NodePtr pop_rightmost(const NodePtr& node, LeafPtr& out);
+        static const Leaf& leaf_at(const NodePtr& node, size_t index);
+        template <typename F>
+        static void for_each_leaf(const NodePtr& node, F& f);
+
+    public:
+        // Constructors
+        PersistentDeque();
+
+        // Modifiers, each returning the new version
+        PersistentDeque push_back(const T& val) const;
+        PersistentDeque push_front(const T& val) const;
+        PersistentDeque pop_back() const;
+        PersistentDeque pop_front() const;
+        PersistentDeque set(size_t pos, const T& val) const;
+
+        // Element access
+        const T& at(size_t pos) const;
+        const T& operator[](size_t pos) const;
+        const T& front() const;
+        const T& back() const;
+
+        // Calls f(const T&) for every element, front to back
+        template <typename F>
+        void for_each(F&& f) const;
+
+        // Capacity
+        bool empty() const;
+        size_t size() const;
+};
+
+#include "Persistent_Deque.cpp"
+#endif //PERSISTENT_DEQUE_H
@@ -0,0 +1,53 @@
+#include "Sliding_Window_Extrema.h"
+
+template <typename T, typename Cmp>
+SlidingWindowExtrema<T, Cmp>::SlidingWindowExtrema(size_t window_size, Cmp cmp)
+    : candidates{}, window_size{window_size}, next_index{0}, cmp{cmp} {
+    if (window_size == 0) {
+        throw std::out_of_range("Window size must be positive");
+    }
+}
+
+// Drop candidates the new value beats, append it, then expire the oldest candidate.
+// The candidate queue is never empty after the push, so the unchecked operations apply.
+template <typename T, typename Cmp>
+void SlidingWindowExtrema<T, Cmp>::push(const T& val) {
+    while (!candidates.empty() && !cmp(candidates.unchecked_back().value, val)) {
+        candidates.unchecked_pop_back();
+    }
+    candidates.push_back(Entry{next_index, val});
+    ++next_index;
+    // At most one candidate leaves the window per push
+    if (candidates.unchecked_front().index + window_size < next_index) {
+        candidates.unchecked_pop_front();
+    }
+}
+
+template <typename T, typename Cmp>
+void SlidingWindowExtrema<T, Cmp>::clear() {
+    candidates.clear();
+    next_index = 0;
+}
+
+template <typename T, typename Cmp>
+const T& SlidingWindowExtrema<T, Cmp>::extremum() const {
+    if (candidates.empty()) {
+        throw std::out_of_range("Window is empty");
+    }
+    return candidates.unchecked_front().value;
+}
+
+template <typename T, typename Cmp>
+size_t SlidingWindowExtrema<T, Cmp>::window() const {
+    return window_size;
+}
+
+template <typename T, typename Cmp>
+size_t SlidingWindowExtrema<T, Cmp>::count() const {
+    return std::min(next_index, window_size);
+}
+
+template <typename T, typename Cmp>
+bool SlidingWindowExtrema<T, Cmp>::empty() const {
+    return next_index == 0;
+}
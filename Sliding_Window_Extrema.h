@@ -0,0 +1,40 @@
+#ifndef SLIDING_WINDOW_EXTREMA_H
+#define SLIDING_WINDOW_EXTREMA_H
+
+#include <cstddef>
+#include <functional>
+#include "Deque.h"
+
+// Rolling minimum (or maximum with std::greater) over the last window_size values.
+// Keeps a monotonic queue of candidates in a Deque, so every value is pushed and
+// popped at most once: amortized O(1) per push.
+template <typename T, typename Cmp = std::less<T>>
+class SlidingWindowExtrema {
+    private:
+        struct Entry {
+            size_t index; // Position of the value in the input stream
+            T value;
+        };
+
+        Deque<Entry> candidates; // Values in stream order, strictly ordered by cmp
+        size_t window_size;
+        size_t next_index;       // Number of values pushed so far
+        Cmp cmp;
+
+    public:
+        // Constructors
+        explicit SlidingWindowExtrema(size_t window_size, Cmp cmp = Cmp());
+
+        // Modifiers
+        void push(const T& val); // Add the next value and slide the window
+        void clear();
+
+        // Access
+        const T& extremum() const; // Best value in the current window
+        size_t window() const;     // Configured window size
+        size_t count() const;      // Values currently inside the window
+        bool empty() const;
+};
+
+#include "Sliding_Window_Extrema.cpp"
+#endif //SLIDING_WINDOW_EXTREMA_H
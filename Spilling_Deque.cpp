@@ -0,0 +1,354 @@
+#include "Spilling_Deque.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <stdexcept>
+#include <unistd.h>
+
+template <typename T>
+SpillingDeque<T>::SpillingDeque(size_t memory_budget, const std::string& directory, size_t _read_ahead)
+    : head{std::make_unique<T[]>(CHUNK_SIZE)}, head_size{0}, middle{},
+      tail{std::make_unique<T[]>(CHUNK_SIZE)}, tail_size{0},
+      budget_chunks{std::max(memory_budget / CHUNK_BYTES, _read_ahead + 1)}, read_ahead{_read_ahead},
+      fd{-1}, file_end{0}, free_offsets{}, resident{0}, evicting{0}, spilled{0}, jobs{}, stopping{false} {
+    std::string path = directory + "/spilling_deque.XXXXXX";
+    fd = ::mkstemp(path.data());
+    if (fd < 0) {
+        throw std::runtime_error("Cannot create spill file in " + directory);
+    }
+    // The file only lives as long as the descriptor
+    ::unlink(path.c_str());
+    worker = std::thread([this] { work(); });
+}
+
+template <typename T>
+SpillingDeque<T>::~SpillingDeque() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    io_ready.notify_all();
+    worker.join();
+    ::close(fd);
+}
+
+// I/O thread: run queued loads and writes, then publish the result under the lock
+template <typename T>
+void SpillingDeque<T>::work() {
+    auto transfer = [this](bool reading, T* data, off_t offset) {
+        char* bytes = reinterpret_cast<char*>(data);
+        size_t done = 0;
+        while (done < CHUNK_BYTES) {
+            ssize_t n = reading ? ::pread(fd, bytes + done, CHUNK_BYTES - done, offset + done)
+                                : ::pwrite(fd, bytes + done, CHUNK_BYTES - done, offset + done);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                return false;
+            }
+            done += static_cast<size_t>(n);
+        }
+        return true;
+    };
+
+    std::unique_lock<std::mutex> guard(lock);
+    for (;;) {
+        io_ready.wait(guard, [this] { return stopping || !jobs.empty(); });
+        Job job;
+        if (stopping || !jobs.try_pop_front(job)) {
+            return;
+        }
+        Segment& segment = *job.segment;
+        off_t offset = segment.offset;
+        if (job.load) {
+            guard.unlock();
+            auto buffer = std::make_unique_for_overwrite<T[]>(CHUNK_SIZE);
+            bool ok = transfer(true, buffer.get(), offset);
+            guard.lock();
+            if (ok) {
+                segment.data = std::move(buffer);
+                segment.state = State::Resident;
+            } else {
+                segment.failed = true;
+                segment.state = State::Spilled;
+                --resident;
+                ++spilled;
+            }
+        } else {
+            // The owner never frees or changes the data of a chunk being written
+            T* data = segment.data.get();
+            guard.unlock();
+            bool ok = transfer(false, data, offset);
+            guard.lock();
+            --evicting;
+            if (!ok) {
+                segment.failed = true;
+                free_offsets.push_back(segment.offset);
+                segment.offset = -1;
+            }
+            if (segment.dropped) {
+                if (segment.offset >= 0) {
+                    free_offsets.push_back(segment.offset);
+                }
+                segment.data.reset();
+                --resident;
+            } else if (!ok || segment.pinned) {
+                segment.state = State::Resident;
+                segment.pinned = false;
+            } else {
+                segment.data.reset();
+                segment.state = State::Spilled;
+                --resident;
+                ++spilled;
+            }
+        }
+        io_done.notify_all();
+    }
+}
+
+template <typename T>
+off_t SpillingDeque<T>::allocate_offset() {
+    off_t offset;
+    if (!free_offsets.try_pop_back(offset)) {
+        offset = file_end;
+        file_end += static_cast<off_t>(CHUNK_BYTES);
+    }
+    return offset;
+}
+
+// Queue a read of a spilled chunk ahead of any pending writes
+template <typename T>
+void SpillingDeque<T>::load(const SegmentPtr& segment) {
+    if (segment->state != State::Spilled || segment->failed) {
+        return;
+    }
+    segment->state = State::Loading;
+    ++resident;
+    --spilled;
+    jobs.push_front(Job{segment, true});
+    io_ready.notify_one();
+}
+
+// Push interior chunks out until the resident ones fit the budget, newest first,
+// never touching the read-ahead window at the front
+template <typename T>
+void SpillingDeque<T>::evict() {
+    while (resident - evicting > budget_chunks) {
+        bool found = false;
+        for (size_t i = middle.size(); i-- > read_ahead;) {
+            Segment& segment = *middle[i];
+            if (segment.state != State::Resident || segment.failed) {
+                continue;
+            }
+            if (segment.offset >= 0) {
+                // Already on disk from an earlier eviction
+                segment.data.reset();
+                segment.state = State::Spilled;
+                --resident;
+                ++spilled;
+            } else {
+                segment.offset = allocate_offset();
+                segment.state = State::Writing;
+                ++evicting;
+                jobs.push_back(Job{middle[i], false});
+                io_ready.notify_one();
+            }
+            found = true;
+            break;
+        }
+        if (!found) {
+            return;
+        }
+    }
+}
+
+// Start loading the chunks the consumer reaches next, keeping ones mid-write in memory.
+// Loads are queued back to front so the nearest chunk is read first.
+template <typename T>
+void SpillingDeque<T>::prefetch() {
+    size_t window = std::min(read_ahead, middle.size());
+    for (size_t i = window; i-- > 0;) {
+        const SegmentPtr& segment = middle[i];
+        if (segment->state == State::Writing) {
+            segment->pinned = true;
+        } else {
+            load(segment);
+        }
+    }
+}
+
+// Wait until a chunk's data is in memory, loading it if needed.
+// A chunk whose earlier read failed is read again; on failure it stays spilled in place.
+template <typename T>
+void SpillingDeque<T>::wait_resident(const SegmentPtr& segment, std::unique_lock<std::mutex>& guard) {
+    if (segment->state == State::Spilled) {
+        segment->failed = false;
+    }
+    load(segment);
+    io_done.wait(guard, [&] {
+        return segment->state == State::Resident || segment->state == State::Writing || segment->failed;
+    });
+    if (segment->state == State::Spilled) {
+        throw std::runtime_error("Failed to read spilled chunk");
+    }
+}
+
+// Move a chunk's elements into buffer; the chunk has left the deque
+template <typename T>
+void SpillingDeque<T>::take(const SegmentPtr& segment, std::unique_ptr<T[]>& buffer) {
+    if (segment->state == State::Writing) {
+        std::copy(segment->data.get(), segment->data.get() + CHUNK_SIZE, buffer.get());
+        segment->dropped = true;
+        return;
+    }
+    buffer.swap(segment->data);
+    release(segment);
+}
+
+// Return a removed resident chunk's memory and file slot
+template <typename T>
+void SpillingDeque<T>::release(const SegmentPtr& segment) {
+    if (segment->offset >= 0) {
+        free_offsets.push_back(segment->offset);
+        segment->offset = -1;
+    }
+    segment->data.reset();
+    --resident;
+}
+
+// Turn a full end buffer into an interior chunk
+template <typename T>
+void SpillingDeque<T>::seal(std::unique_ptr<T[]>& buffer, bool at_front) {
+    auto segment = std::make_shared<Segment>();
+    segment->data = std::move(buffer);
+    buffer = std::make_unique_for_overwrite<T[]>(CHUNK_SIZE);
+    if (at_front) {
+        middle.push_front(segment);
+    } else {
+        middle.push_back(segment);
+    }
+    std::lock_guard<std::mutex> guard(lock);
+    ++resident;
+    evict();
+}
+
+template <typename T>
+void SpillingDeque<T>::refill_front() {
+    if (!middle.empty()) {
+        // The chunk leaves the deque only once its data is in hand
+        SegmentPtr segment = middle.front();
+        std::unique_lock<std::mutex> guard(lock);
+        prefetch();
+        wait_resident(segment, guard);
+        take(segment, head);
+        middle.pop_front();
+        head_size = CHUNK_SIZE;
+        evict();
+    } else {
+        std::copy(tail.get(), tail.get() + tail_size, head.get() + CHUNK_SIZE - tail_size);
+        head_size = tail_size;
+        tail_size = 0;
+    }
+}
+
+template <typename T>
+void SpillingDeque<T>::refill_back() {
+    if (!middle.empty()) {
+        SegmentPtr segment = middle.back();
+        std::unique_lock<std::mutex> guard(lock);
+        wait_resident(segment, guard);
+        take(segment, tail);
+        middle.pop_back();
+        tail_size = CHUNK_SIZE;
+    } else {
+        std::copy(head.get() + CHUNK_SIZE - head_size, head.get() + CHUNK_SIZE, tail.get());
+        tail_size = head_size;
+        head_size = 0;
+    }
+}
+
+template <typename T>
+void SpillingDeque<T>::push_back(const T& val) {
+    if (tail_size == CHUNK_SIZE) {
+        seal(tail, false);
+        tail_size = 0;
+    }
+    tail[tail_size++] = val;
+}
+
+template <typename T>
+void SpillingDeque<T>::push_front(const T& val) {
+    if (head_size == CHUNK_SIZE) {
+        seal(head, true);
+        head_size = 0;
+    }
+    ++head_size;
+    head[CHUNK_SIZE - head_size] = val;
+}
+
+template <typename T>
+void SpillingDeque<T>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("Cannot pop from an empty deque");
+    }
+    if (tail_size == 0) {
+        refill_back();
+    }
+    --tail_size;
+}
+
+template <typename T>
+void SpillingDeque<T>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("Cannot pop from an empty deque");
+    }
+    if (head_size == 0) {
+        refill_front();
+    }
+    --head_size;
+}
+
+template <typename T>
+T SpillingDeque<T>::front() {
+    if (empty()) {
+        throw std::out_of_range("Deque is empty");
+    }
+    if (head_size == 0) {
+        refill_front();
+    }
+    return head[CHUNK_SIZE - head_size];
+}
+
+template <typename T>
+T SpillingDeque<T>::back() {
+    if (empty()) {
+        throw std::out_of_range("Deque is empty");
+    }
+    if (tail_size == 0) {
+        refill_back();
+    }
+    return tail[tail_size - 1];
+}
+
+template <typename T>
+bool SpillingDeque<T>::empty() const {
+    return size() == 0;
+}
+
+template <typename T>
+size_t SpillingDeque<T>::size() const {
+    return head_size + middle.size() * CHUNK_SIZE + tail_size;
+}
+
+template <typename T>
+size_t SpillingDeque<T>::resident_chunks() {
+    std::lock_guard<std::mutex> guard(lock);
+    return resident;
+}
+
+template <typename T>
+size_t SpillingDeque<T>::spilled_chunks() {
+    std::lock_guard<std::mutex> guard(lock);
+    return spilled;
+}
@@ -0,0 +1,108 @@
+#ifndef SPILLING_DEQUE_H
+#define SPILLING_DEQUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <sys/types.h>
+#include <thread>
+#include <type_traits>
+#include "Deque.h"
+
+// Deque that can outgrow memory. The head and tail chunks always stay in memory;
+// full interior chunks are counted against a memory budget and, once it is
+// exceeded, written to an unlinked temporary file by a background I/O thread.
+// Chunks near the front are read back ahead of the consumer, so a FIFO backlog
+// drains without waiting on the disk in the common case.
+//
+// Interior chunks never change once sealed, so a chunk reloaded from the file
+// keeps its file slot and can be evicted again without another write.
+template <typename T>
+class SpillingDeque {
+    static_assert(std::is_trivially_copyable_v<T>, "SpillingDeque requires trivially copyable elements");
+
+    private:
+        static constexpr size_t CHUNK_SIZE = 128;   // Elements per chunk, matches Deque
+        static constexpr size_t CHUNK_BYTES = CHUNK_SIZE * sizeof(T);
+
+        enum class State { Resident, Writing, Spilled, Loading };
+
+        struct Segment {
+            std::unique_ptr<T[]> data; // Null while spilled or loading
+            State state = State::Resident;
+            off_t offset = -1;         // File slot, -1 until first written
+            bool pinned = false;       // Wanted back while being written: keep it in memory
+            bool dropped = false;      // Removed from the deque while being written
+            bool failed = false;       // I/O failed, never evict again
+        };
+        using SegmentPtr = std::shared_ptr<Segment>;
+
+        struct Job {
+            SegmentPtr segment;
+            bool load;
+        };
+
+        // Owner-thread state
+        std::unique_ptr<T[]> head; // Front elements occupy the last head_size slots
+        size_t head_size;
+        Deque<SegmentPtr> middle;  // Full chunks between head and tail
+        std::unique_ptr<T[]> tail; // Back elements occupy the first tail_size slots
+        size_t tail_size;
+        size_t budget_chunks;      // Interior chunks allowed in memory
+        size_t read_ahead;         // Front chunks kept loaded ahead of the consumer
+
+        // Shared with the I/O thread, guarded by lock
+        int fd;
+        off_t file_end;
+        Deque<off_t> free_offsets;
+        size_t resident;  // Interior chunks in memory or being loaded
+        size_t evicting;  // Of those, chunks being written out
+        size_t spilled;   // Interior chunks only on disk
+        Deque<Job> jobs;  // Loads are queued at the front, writes at the back
+        bool stopping;
+        std::mutex lock;
+        std::condition_variable io_ready;
+        std::condition_variable io_done;
+        std::thread worker;
+
+        void work();
+        void load(const SegmentPtr& segment);      // Caller holds lock
+        off_t allocate_offset();                   // Caller holds lock
+        void evict();                              // Caller holds lock
+        void prefetch();                           // Caller holds lock
+        void release(const SegmentPtr& segment);   // Caller holds lock
+        void wait_resident(const SegmentPtr& segment, std::unique_lock<std::mutex>& guard);
+        void take(const SegmentPtr& segment, std::unique_ptr<T[]>& buffer); // Caller holds lock
+        void seal(std::unique_ptr<T[]>& buffer, bool at_front);
+        void refill_front();
+        void refill_back();
+
+    public:
+        // Constructors
+        explicit SpillingDeque(size_t memory_budget, const std::string& directory = "/tmp",
+                               size_t read_ahead = 4);
+        ~SpillingDeque();
+        SpillingDeque(const SpillingDeque&) = delete;
+        SpillingDeque& operator=(const SpillingDeque&) = delete;
+
+        // Modifiers
+        void push_back(const T& val);
+        void push_front(const T& val);
+        void pop_back();
+        void pop_front();
+
+        // Element access, loading the end chunk if it was spilled
+        T front();
+        T back();
+
+        // Capacity
+        bool empty() const;
+        size_t size() const;
+        size_t resident_chunks();
+        size_t spilled_chunks();
+};
+
+#include "Spilling_Deque.cpp"
+#endif //SPILLING_DEQUE_H
@@ -0,0 +1,418 @@
+#include "Static_Deque.h"
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr StaticIterator<T, Capacity, IsConst, IsReverse>::StaticIterator()
+    : storage{nullptr}, head{0}, index{0} {}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr StaticIterator<T, Capacity, IsConst, IsReverse>::StaticIterator(
+    pointer _storage, size_t _head, difference_type _index)
+    : storage{_storage}, head{_head}, index{_index} {}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr StaticIterator<T, Capacity, IsConst, IsReverse>
+StaticIterator<T, Capacity, IsConst, IsReverse>::operator+(difference_type n) const {
+    StaticIterator temp = *this;
+    temp += n;
+    return temp;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr StaticIterator<T, Capacity, IsConst, IsReverse>
+StaticIterator<T, Capacity, IsConst, IsReverse>::operator-(difference_type n) const {
+    StaticIterator temp = *this;
+    temp -= n;
+    return temp;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr typename StaticIterator<T, Capacity, IsConst, IsReverse>::difference_type
+StaticIterator<T, Capacity, IsConst, IsReverse>::operator-(const StaticIterator& other) const {
+    return IsReverse ? other.index - index : index - other.index;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr StaticIterator<T, Capacity, IsConst, IsReverse>&
+StaticIterator<T, Capacity, IsConst, IsReverse>::operator++() {
+    return *this += 1;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr StaticIterator<T, Capacity, IsConst, IsReverse>
+StaticIterator<T, Capacity, IsConst, IsReverse>::operator++(int) {
+    StaticIterator tmp = *this;
+    *this += 1;
+    return tmp;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr StaticIterator<T, Capacity, IsConst, IsReverse>&
+StaticIterator<T, Capacity, IsConst, IsReverse>::operator--() {
+    return *this -= 1;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr StaticIterator<T, Capacity, IsConst, IsReverse>
+StaticIterator<T, Capacity, IsConst, IsReverse>::operator--(int) {
+    StaticIterator tmp = *this;
+    *this -= 1;
+    return tmp;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr StaticIterator<T, Capacity, IsConst, IsReverse>&
+StaticIterator<T, Capacity, IsConst, IsReverse>::operator+=(difference_type n) {
+    if constexpr (IsReverse) {
+        index -= n;
+    } else {
+        index += n;
+    }
+    return *this;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr StaticIterator<T, Capacity, IsConst, IsReverse>&
+StaticIterator<T, Capacity, IsConst, IsReverse>::operator-=(difference_type n) {
+    return *this += -n;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr typename StaticIterator<T, Capacity, IsConst, IsReverse>::pointer
+StaticIterator<T, Capacity, IsConst, IsReverse>::operator->() const {
+    size_t slot = head + static_cast<size_t>(index);
+    if constexpr ((Capacity & (Capacity - 1)) == 0) {
+        return storage + (slot & (Capacity - 1));
+    } else {
+        return storage + (slot >= Capacity ? slot - Capacity : slot);
+    }
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr typename StaticIterator<T, Capacity, IsConst, IsReverse>::reference
+StaticIterator<T, Capacity, IsConst, IsReverse>::operator*() const {
+    return *operator->();
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr typename StaticIterator<T, Capacity, IsConst, IsReverse>::reference
+StaticIterator<T, Capacity, IsConst, IsReverse>::operator[](difference_type n) const {
+    return *(*this + n);
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr bool StaticIterator<T, Capacity, IsConst, IsReverse>::operator>(const StaticIterator& other) const {
+    return *this - other > 0;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr bool StaticIterator<T, Capacity, IsConst, IsReverse>::operator<(const StaticIterator& other) const {
+    return *this - other < 0;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr bool StaticIterator<T, Capacity, IsConst, IsReverse>::operator>=(const StaticIterator& other) const {
+    return *this - other >= 0;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr bool StaticIterator<T, Capacity, IsConst, IsReverse>::operator<=(const StaticIterator& other) const {
+    return *this - other <= 0;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr bool StaticIterator<T, Capacity, IsConst, IsReverse>::operator==(const StaticIterator& other) const {
+    return index == other.index;
+}
+
+template <typename T, size_t Capacity, bool IsConst, bool IsReverse>
+constexpr bool StaticIterator<T, Capacity, IsConst, IsReverse>::operator!=(const StaticIterator& other) const {
+    return index != other.index;
+}
+
+// Wrap a slot index back into the ring: a mask for powers of two, one compare otherwise
+template <typename T, size_t Capacity>
+constexpr size_t StaticDeque<T, Capacity>::wrap(size_t slot) {
+    if constexpr (POWER_OF_TWO) {
+        return slot & (Capacity - 1);
+    } else {
+        return slot >= Capacity ? slot - Capacity : slot;
+    }
+}
+
+template <typename T, size_t Capacity>
+constexpr size_t StaticDeque<T, Capacity>::slot_of(size_t pos) const {
+    return wrap(head + pos);
+}
+
+template <typename T, size_t Capacity>
+constexpr StaticDeque<T, Capacity>::StaticDeque() : head{0}, num_elements{0} {}
+
+// Constructor: create a deque with n default elements
+template <typename T, size_t Capacity>
+constexpr StaticDeque<T, Capacity>::StaticDeque(size_t n) : head{0}, num_elements{n} {
+    if (n > Capacity) {
+        throw std::out_of_range("StaticDeque capacity exceeded");
+    }
+}
+
+// Add an element to the back of the deque
+template <typename T, size_t Capacity>
+constexpr void StaticDeque<T, Capacity>::push_back(const T& val) {
+    if (num_elements == Capacity) {
+        throw std::out_of_range("StaticDeque is full");
+    }
+    storage[slot_of(num_elements)] = val;
+    ++num_elements;
+}
+
+// Add an element to the front of the deque
+template <typename T, size_t Capacity>
+constexpr void StaticDeque<T, Capacity>::push_front(const T& val) {
+    if (num_elements == Capacity) {
+        throw std::out_of_range("StaticDeque is full");
+    }
+    head = wrap(head + Capacity - 1);
+    storage[head] = val;
+    ++num_elements;
+}
+
+template <typename T, size_t Capacity>
+template <typename... Args>
+constexpr void StaticDeque<T, Capacity>::emplace_back(Args&&... args) {
+    if (num_elements == Capacity) {
+        throw std::out_of_range("StaticDeque is full");
+    }
+    storage[slot_of(num_elements)] = T(std::forward<Args>(args)...);
+    ++num_elements;
+}
+
+template <typename T, size_t Capacity>
+template <typename... Args>
+constexpr void StaticDeque<T, Capacity>::emplace_front(Args&&... args) {
+    if (num_elements == Capacity) {
+        throw std::out_of_range("StaticDeque is full");
+    }
+    head = wrap(head + Capacity - 1);
+    storage[head] = T(std::forward<Args>(args)...);
+    ++num_elements;
+}
+
+// Remove an element from the back; the slot is reset so owned resources are released
+template <typename T, size_t Capacity>
+constexpr void StaticDeque<T, Capacity>::pop_back() {
+    if (num_elements == 0) {
+        throw std::out_of_range("Cannot pop from an empty deque");
+    }
+    --num_elements;
+    storage[slot_of(num_elements)] = T{};
+}
+
+// Remove an element from the front
+template <typename T, size_t Capacity>
+constexpr void StaticDeque<T, Capacity>::pop_front() {
+    if (num_elements == 0) {
+        throw std::out_of_range("Cannot pop from an empty deque");
+    }
+    storage[head] = T{};
+    head = wrap(head + 1);
+    --num_elements;
+}
+
+template <typename T, size_t Capacity>
+constexpr void StaticDeque<T, Capacity>::clear() {
+    for (size_t i = 0; i < num_elements; ++i) {
+        storage[slot_of(i)] = T{};
+    }
+    head = 0;
+    num_elements = 0;
+}
+
+template <typename T, size_t Capacity>
+constexpr void StaticDeque<T, Capacity>::swap(StaticDeque& other) noexcept {
+    for (size_t i = 0; i < Capacity; ++i) {
+        std::swap(storage[i], other.storage[i]);
+    }
+    std::swap(head, other.head);
+    std::swap(num_elements, other.num_elements);
+}
+
+// Access element at pos with bounds checking
+template <typename T, size_t Capacity>
+constexpr T& StaticDeque<T, Capacity>::at(size_t pos) {
+    if (pos >= num_elements) {
+        throw std::out_of_range("Deque index out of range");
+    }
+    return storage[slot_of(pos)];
+}
+
+template <typename T, size_t Capacity>
+constexpr const T& StaticDeque<T, Capacity>::at(size_t pos) const {
+    if (pos >= num_elements) {
+        throw std::out_of_range("Deque index out of range");
+    }
+    return storage[slot_of(pos)];
+}
+
+// Return first element
+template <typename T, size_t Capacity>
+constexpr T& StaticDeque<T, Capacity>::front() {
+    if (num_elements == 0) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return storage[head];
+}
+
+template <typename T, size_t Capacity>
+constexpr const T& StaticDeque<T, Capacity>::front() const {
+    if (num_elements == 0) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return storage[head];
+}
+
+// Return last element
+template <typename T, size_t Capacity>
+constexpr T& StaticDeque<T, Capacity>::back() {
+    if (num_elements == 0) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return storage[slot_of(num_elements - 1)];
+}
+
+template <typename T, size_t Capacity>
+constexpr const T& StaticDeque<T, Capacity>::back() const {
+    if (num_elements == 0) {
+        throw std::out_of_range("Deque is empty");
+    }
+    return storage[slot_of(num_elements - 1)];
+}
+
+// Operator[] uses at() for bounds checking
+template <typename T, size_t Capacity>
+constexpr T& StaticDeque<T, Capacity>::operator[](size_t pos) {
+    return at(pos);
+}
+
+template <typename T, size_t Capacity>
+constexpr const T& StaticDeque<T, Capacity>::operator[](size_t pos) const {
+    return at(pos);
+}
+
+// Comparison operators
+template <typename T, size_t Capacity>
+constexpr bool operator==(const StaticDeque<T, Capacity>& lhs, const StaticDeque<T, Capacity>& rhs) {
+    if (lhs.size() != rhs.size()) return false;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        if (lhs.storage[lhs.slot_of(i)] != rhs.storage[rhs.slot_of(i)]) return false;
+    }
+    return true;
+}
+
+template <typename T, size_t Capacity>
+constexpr bool operator!=(const StaticDeque<T, Capacity>& lhs, const StaticDeque<T, Capacity>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename T, size_t Capacity>
+constexpr bool operator<(const StaticDeque<T, Capacity>& lhs, const StaticDeque<T, Capacity>& rhs) {
+    size_t common = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+    for (size_t i = 0; i < common; ++i) {
+        const T& a = lhs.storage[lhs.slot_of(i)];
+        const T& b = rhs.storage[rhs.slot_of(i)];
+        if (a < b) return true;
+        if (b < a) return false;
+    }
+    return lhs.size() < rhs.size();
+}
+
+template <typename T, size_t Capacity>
+constexpr bool operator>(const StaticDeque<T, Capacity>& lhs, const StaticDeque<T, Capacity>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename T, size_t Capacity>
+constexpr bool operator<=(const StaticDeque<T, Capacity>& lhs, const StaticDeque<T, Capacity>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename T, size_t Capacity>
+constexpr bool operator>=(const StaticDeque<T, Capacity>& lhs, const StaticDeque<T, Capacity>& rhs) {
+    return !(lhs < rhs);
+}
+
+// Iterators
+template <typename T, size_t Capacity>
+constexpr typename StaticDeque<T, Capacity>::iterator StaticDeque<T, Capacity>::begin() {
+    return iterator(storage, head, 0);
+}
+
+template <typename T, size_t Capacity>
+constexpr typename StaticDeque<T, Capacity>::const_iterator StaticDeque<T, Capacity>::begin() const {
+    return const_iterator(storage, head, 0);
+}
+
+template <typename T, size_t Capacity>
+constexpr typename StaticDeque<T, Capacity>::const_iterator StaticDeque<T, Capacity>::cbegin() const {
+    return const_iterator(storage, head, 0);
+}
+
+template <typename T, size_t Capacity>
+constexpr typename StaticDeque<T, Capacity>::reverse_iterator StaticDeque<T, Capacity>::rbegin() {
+    return reverse_iterator(storage, head, static_cast<std::ptrdiff_t>(num_elements) - 1);
+}
+
+template <typename T, size_t Capacity>
+constexpr typename StaticDeque<T, Capacity>::const_reverse_iterator StaticDeque<T, Capacity>::crbegin() const {
+    return const_reverse_iterator(storage, head, static_cast<std::ptrdiff_t>(num_elements) - 1);
+}
+
+template <typename T, size_t Capacity>
+constexpr typename StaticDeque<T, Capacity>::iterator StaticDeque<T, Capacity>::end() {
+    return iterator(storage, head, static_cast<std::ptrdiff_t>(num_elements));
+}
+
+template <typename T, size_t Capacity>
+constexpr typename StaticDeque<T, Capacity>::const_iterator StaticDeque<T, Capacity>::end() const {
+    return const_iterator(storage, head, static_cast<std::ptrdiff_t>(num_elements));
+}
+
+template <typename T, size_t Capacity>
+constexpr typename StaticDeque<T, Capacity>::const_iterator StaticDeque<T, Capacity>::cend() const {
+    return const_iterator(storage, head, static_cast<std::ptrdiff_t>(num_elements));
+}
+
+template <typename T, size_t Capacity>
+constexpr typename StaticDeque<T, Capacity>::reverse_iterator StaticDeque<T, Capacity>::rend() {
+    return reverse_iterator(storage, head, -1);
+}
+
+template <typename T, size_t Capacity>
+constexpr typename StaticDeque<T, Capacity>::const_reverse_iterator StaticDeque<T, Capacity>::crend() const {
+    return const_reverse_iterator(storage, head, -1);
+}
+
+// Capacity
+template <typename T, size_t Capacity>
+constexpr bool StaticDeque<T, Capacity>::empty() const {
+    return num_elements == 0;
+}
+
+template <typename T, size_t Capacity>
+constexpr bool StaticDeque<T, Capacity>::full() const {
+    return num_elements == Capacity;
+}
+
+template <typename T, size_t Capacity>
+constexpr size_t StaticDeque<T, Capacity>::size() const {
+    return num_elements;
+}
+
+template <typename T, size_t Capacity>
+constexpr size_t StaticDeque<T, Capacity>::capacity() {
+    return Capacity;
+}
+
+template <typename T, size_t Capacity>
+constexpr size_t StaticDeque<T, Capacity>::max_size() {
+    return Capacity;
+}
@@ -0,0 +1,150 @@
+#ifndef STATIC_DEQUE_H
+#define STATIC_DEQUE_H
+
+#include <iterator>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+template <typename T, size_t Capacity>
+class StaticDeque;
+
+// Random-access iterator over a StaticDeque, mirroring BaseIterator's parameters
+template <typename T, size_t Capacity, bool IsConst = false, bool IsReverse = false>
+class StaticIterator {
+    public:
+
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<IsConst, const T&, T&>;
+    using const_reference = const T&;
+    using pointer = std::conditional_t<IsConst, const T*, T*>;
+
+    private:
+    friend StaticDeque<T, Capacity>;
+    pointer storage;
+    size_t head;
+    difference_type index; // Logical position from the front of the deque
+
+    constexpr StaticIterator(pointer _storage, size_t _head, difference_type _index);
+
+public:
+    constexpr StaticIterator();
+
+    constexpr StaticIterator operator+(difference_type n) const;
+    constexpr StaticIterator operator-(difference_type n) const;
+    constexpr difference_type operator-(const StaticIterator& other) const;
+
+    constexpr StaticIterator& operator++();
+    constexpr StaticIterator operator++(int);
+    constexpr StaticIterator& operator--();
+    constexpr StaticIterator operator--(int);
+
+    constexpr StaticIterator& operator+=(difference_type n);
+    constexpr StaticIterator& operator-=(difference_type n);
+
+    constexpr pointer operator->() const;
+    constexpr reference operator*() const;
+    constexpr reference operator[](difference_type n) const;
+
+    constexpr bool operator>(const StaticIterator& other) const;
+    constexpr bool operator<(const StaticIterator& other) const;
+    constexpr bool operator>=(const StaticIterator& other) const;
+    constexpr bool operator<=(const StaticIterator& other) const;
+    constexpr bool operator==(const StaticIterator& other) const;
+    constexpr bool operator!=(const StaticIterator& other) const;
+};
+
+// Fixed-capacity deque stored inline, usable in constexpr contexts.
+// Indices wrap with a mask when Capacity is a power of two.
+template <typename T, size_t Capacity>
+class StaticDeque {
+    private:
+        static_assert(Capacity > 0, "StaticDeque needs a non-zero capacity");
+        static_assert(std::is_default_constructible_v<T>, "StaticDeque stores default-constructed slots");
+
+        static constexpr bool POWER_OF_TWO = (Capacity & (Capacity - 1)) == 0;
+
+        T storage[Capacity]{};
+        size_t head;         // Slot of the first element
+        size_t num_elements;
+
+        static constexpr size_t wrap(size_t slot); // slot < 2 * Capacity
+        constexpr size_t slot_of(size_t pos) const;
+
+    public:
+        using iterator = StaticIterator<T, Capacity, false, false>;
+        using const_iterator = StaticIterator<T, Capacity, true, false>;
+        using reverse_iterator = StaticIterator<T, Capacity, false, true>;
+        using const_reverse_iterator = StaticIterator<T, Capacity, true, true>;
+
+        // Constructors
+        constexpr StaticDeque();
+        constexpr StaticDeque(size_t n);
+        constexpr StaticDeque(const StaticDeque& other) = default;
+        constexpr StaticDeque(StaticDeque&& other) noexcept = default;
+
+        // Assignment operators
+        constexpr StaticDeque& operator=(const StaticDeque& other) = default;
+        constexpr StaticDeque& operator=(StaticDeque&& other) noexcept = default;
+
+        // Modifiers
+        constexpr void push_back(const T& val);
+        constexpr void push_front(const T& val);
+        template <typename... Args>
+        constexpr void emplace_back(Args&&... args);
+        template <typename... Args>
+        constexpr void emplace_front(Args&&... args);
+        constexpr void pop_back();
+        constexpr void pop_front();
+        constexpr void clear();
+        constexpr void swap(StaticDeque& other) noexcept;
+
+        // Element access
+        constexpr T& at(size_t pos);
+        constexpr const T& at(size_t pos) const;
+        constexpr T& front();
+        constexpr const T& front() const;
+        constexpr T& back();
+        constexpr const T& back() const;
+        constexpr T& operator[](size_t pos);
+        constexpr const T& operator[](size_t pos) const;
+
+        // Comparison operators
+        template <typename U, size_t N>
+        friend constexpr bool operator==(const StaticDeque<U, N>& lhs, const StaticDeque<U, N>& rhs);
+        template <typename U, size_t N>
+        friend constexpr bool operator!=(const StaticDeque<U, N>& lhs, const StaticDeque<U, N>& rhs);
+        template <typename U, size_t N>
+        friend constexpr bool operator<(const StaticDeque<U, N>& lhs, const StaticDeque<U, N>& rhs);
+        template <typename U, size_t N>
+        friend constexpr bool operator>(const StaticDeque<U, N>& lhs, const StaticDeque<U, N>& rhs);
+        template <typename U, size_t N>
+        friend constexpr bool operator<=(const StaticDeque<U, N>& lhs, const StaticDeque<U, N>& rhs);
+        template <typename U, size_t N>
+        friend constexpr bool operator>=(const StaticDeque<U, N>& lhs, const StaticDeque<U, N>& rhs);
+
+        // Iterators
+        constexpr iterator begin();
+        constexpr const_iterator begin() const;
+        constexpr const_iterator cbegin() const;
+        constexpr reverse_iterator rbegin();
+        constexpr const_reverse_iterator crbegin() const;
+        constexpr iterator end();
+        constexpr const_iterator end() const;
+        constexpr const_iterator cend() const;
+        constexpr reverse_iterator rend();
+        constexpr const_reverse_iterator crend() const;
+
+        // Capacity
+        constexpr bool empty() const;
+        constexpr bool full() const;
+        constexpr size_t size() const;
+        static constexpr size_t capacity();
+        static constexpr size_t max_size();
+};
+
+#include "Static_Deque.cpp"
+#endif //STATIC_DEQUE_H
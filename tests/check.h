@@ -0,0 +1,29 @@
+#ifndef TESTS_CHECK_H
+#define TESTS_CHECK_H
+
+#include <iostream>
+
+// Minimal test harness: CHECK reports a failed condition and keeps going,
+// main returns check_result() so the run fails if any check did.
+inline int& check_failures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(condition)                                                                \
+    do {                                                                                \
+        if (!(condition)) {                                                             \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed\n"; \
+            ++check_failures();                                                         \
+        }                                                                               \
+    } while (0)
+
+inline int check_result() {
+    if (check_failures() > 0) {
+        std::cerr << check_failures() << " check(s) failed\n";
+        return 1;
+    }
+    return 0;
+}
+
+#endif //TESTS_CHECK_H
@@ -0,0 +1,25 @@
+#ifndef TESTS_COUNTING_POOL_H
+#define TESTS_COUNTING_POOL_H
+
+#include <cstddef>
+#include "Chunk_Pool.h"
+
+// Heap-backed chunk pool that counts its traffic
+template <typename T>
+class CountingPool : public ChunkPool<T> {
+    public:
+        size_t allocated = 0;
+        size_t released = 0;
+
+        T* allocate() override {
+            ++allocated;
+            return new T[ChunkPool<T>::CHUNK_SIZE]();
+        }
+
+        void deallocate(T* chunk) noexcept override {
+            ++released;
+            delete[] chunk;
+        }
+};
+
+#endif //TESTS_COUNTING_POOL_H
@@ -0,0 +1,27 @@
+#!/bin/sh
+# Build every tests/test_*.cpp with the sanitizers enabled and run it.
+# The library is header-only, so each test is a single translation unit.
+# Usage: tests/run.sh            (CXX and CXXFLAGS are honoured)
+set -u
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:-"-std=c++20 -g -O1 -Wall -Wextra -fsanitize=address,undefined"}
+tests_dir=$(cd "$(dirname "$0")" && pwd)
+build_dir=$(mktemp -d)
+trap 'rm -rf "$build_dir"' EXIT
+
+status=0
+for source in "$tests_dir"/test_*.cpp; do
+    name=$(basename "$source" .cpp)
+    if ! $CXX $CXXFLAGS -pthread -I"$tests_dir/.." "$source" -o "$build_dir/$name"; then
+        echo "BUILD FAILED $name"
+        status=1
+        continue
+    fi
+    if "$build_dir/$name"; then
+        echo "ok     $name"
+    else
+        echo "FAILED $name"
+        status=1
+    fi
+done
+exit $status
@@ -0,0 +1,94 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "Async_Deque.h"
+#include "check.h"
+
+static DetachedTask produce(AsyncDeque<int>& queue, Executor& executor, int count) {
+    co_await executor.schedule();
+    for (int i = 1; i <= count; ++i) {
+        co_await queue.push_back(i);
+    }
+    co_await queue.push_back(0);
+}
+
+static DetachedTask consume(AsyncDeque<int>& queue, Executor& executor, std::vector<int>& seen,
+                            std::atomic<int>& done) {
+    co_await executor.schedule();
+    for (;;) {
+        int value = co_await queue.pop_front();
+        if (value == 0) {
+            break;
+        }
+        seen.push_back(value);
+    }
+    ++done;
+}
+
+// One producer and one consumer on a single thread, through a queue much smaller than the stream
+static void test_single_thread_order() {
+    ManualExecutor executor;
+    AsyncDeque<int> queue(executor, 4);
+    std::vector<int> seen;
+    std::atomic<int> done{0};
+    consume(queue, executor, seen, done);
+    produce(queue, executor, 100000);
+    executor.run();
+    CHECK(done == 1);
+    CHECK(seen.size() == 100000);
+    bool in_order = true;
+    for (size_t i = 0; i < seen.size(); ++i) {
+        in_order = in_order && seen[i] == static_cast<int>(i + 1);
+    }
+    CHECK(in_order);
+    CHECK(queue.empty());
+}
+
+static void test_try_operations() {
+    ManualExecutor executor;
+    AsyncDeque<int> queue(executor, 2);
+    CHECK(!queue.try_pop_front());
+    CHECK(queue.try_push_back(1));
+    CHECK(queue.try_push_back(2));
+    CHECK(!queue.try_push_back(3));
+    CHECK(queue.size() == 2);
+    CHECK(queue.try_pop_front() == 1);
+    CHECK(queue.try_pop_front() == 2);
+    CHECK(queue.empty());
+}
+
+// Several producers and consumers on a pool: every value is delivered exactly once
+static void test_thread_pool() {
+    std::atomic<int> done{0};
+    std::vector<std::vector<int>> seen(3);
+    {
+        ThreadPoolExecutor executor(4);
+        AsyncDeque<int> queue(executor, 16);
+        for (auto& values : seen) {
+            consume(queue, executor, values, done);
+        }
+        for (int p = 0; p < 3; ++p) {
+            produce(queue, executor, 50000);
+        }
+        while (done < 3) {
+            std::this_thread::yield();
+        }
+    }
+    long total = 0;
+    size_t count = 0;
+    for (const auto& values : seen) {
+        for (int value : values) {
+            total += value;
+        }
+        count += values.size();
+    }
+    CHECK(count == 150000);
+    CHECK(total == 3L * 50000 * 50001 / 2);
+}
+
+int main() {
+    test_single_thread_order();
+    test_try_operations();
+    test_thread_pool();
+    return check_result();
+}
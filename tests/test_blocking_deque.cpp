@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "Blocking_Deque.h"
+#include "check.h"
+
+// Mixed single and batch pushes from several producers reach batch consumers exactly once
+static void test_producers_and_consumers() {
+    BlockingDeque<long> queue;
+    std::atomic<long> sum{0};
+    std::atomic<long> count{0};
+    const int producers = 3;
+    const int per_producer = 100000;
+    std::vector<std::thread> threads;
+    for (int c = 0; c < 3; ++c) {
+        threads.emplace_back([&] {
+            long batch[64];
+            for (;;) {
+                size_t n = queue.pop_batch(batch, 64, std::chrono::milliseconds(200));
+                if (n == 0) {
+                    break;
+                }
+                for (size_t i = 0; i < n; ++i) {
+                    sum += batch[i];
+                }
+                count += static_cast<long>(n);
+            }
+        });
+    }
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            for (int i = 1; i <= per_producer;) {
+                if (i % 3 == 0) {
+                    long batch[10];
+                    int n = std::min(10, per_producer - i + 1);
+                    for (int k = 0; k < n; ++k) {
+                        batch[k] = i + k;
+                    }
+                    queue.push_batch(batch, n);
+                    i += n;
+                } else {
+                    queue.push(i++);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK(count == static_cast<long>(producers) * per_producer);
+    CHECK(sum == static_cast<long>(producers) * per_producer * (per_producer + 1) / 2);
+    CHECK(queue.empty());
+}
+
+static void test_timeouts() {
+    BlockingDeque<int> queue;
+    int out = 0;
+    CHECK(!queue.try_pop(out));
+    auto started = std::chrono::steady_clock::now();
+    CHECK(!queue.pop(out, std::chrono::milliseconds(5)));
+    CHECK(std::chrono::steady_clock::now() - started >= std::chrono::milliseconds(5));
+
+    queue.push(4);
+    CHECK(queue.pop(out, std::chrono::milliseconds(5)));
+    CHECK(out == 4);
+
+    std::thread late([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.push(9);
+    });
+    CHECK(queue.pop(out));
+    CHECK(out == 9);
+    late.join();
+}
+
+int main() {
+    test_producers_and_consumers();
+    test_timeouts();
+    return check_result();
+}
@@ -0,0 +1,149 @@
+#include <cstdlib>
+#include <fcntl.h>
+#include <limits>
+#include <new>
+#include <string>
+#include <unistd.h>
+#include "Byte_Deque.h"
+#include "check.h"
+
+// Chunks come from new[], so counting it counts chunk allocations
+static size_t array_allocations = 0;
+
+void* operator new[](size_t size) {
+    ++array_allocations;
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+// Copying a deque that never allocated, or that emptied again, must not touch its chunk map
+static void test_copy_empty() {
+    Deque<int> never_used;
+    Deque<int> copy(never_used);
+    CHECK(copy.empty());
+
+    Deque<int> drained;
+    for (int i = 0; i < 300; ++i) {
+        drained.push_back(i);
+    }
+    while (!drained.empty()) {
+        drained.pop_front();
+    }
+    Deque<int> drained_copy(drained);
+    CHECK(drained_copy.empty());
+    drained_copy.push_back(7);
+    CHECK(drained_copy.front() == 7);
+
+    ByteDeque bytes;
+    ByteDeque bytes_copy(bytes);
+    CHECK(bytes_copy.empty());
+}
+
+// A copy starts at the same offset inside its first chunk as the original
+static void test_copy_offset() {
+    Deque<int> source;
+    for (int i = 0; i < 300; ++i) {
+        source.push_front(i);
+    }
+    Deque<int> copy(source);
+    CHECK(copy.size() == 300);
+    CHECK(copy[0] == 299);
+    CHECK(copy[299] == 0);
+    copy.push_front(300);
+    CHECK(source.size() == 300);
+    CHECK(copy.front() == 300);
+}
+
+static void test_read_write() {
+    ByteDeque buffer;
+    std::string text(1000, 'a');
+    buffer.write(text.data(), text.size());
+    buffer.write("xyz", 3);
+    CHECK(buffer.size() == 1003);
+
+    char peeked[3];
+    CHECK(buffer.peek(peeked, 3, 1000) == 3);
+    CHECK(std::string(peeked, 3) == "xyz");
+
+    buffer.discard(998);
+    char out[8];
+    CHECK(buffer.read(out, sizeof(out)) == 5);
+    CHECK(std::string(out, 5) == "aaxyz");
+    CHECK(buffer.empty());
+}
+
+// An unbounded max must grow the buffer by at most what one readv can fill
+static void test_write_from_unbounded() {
+    int fds[2];
+    CHECK(::pipe(fds) == 0);
+    std::string payload(5000, 'p');
+    CHECK(::write(fds[1], payload.data(), payload.size()) == static_cast<ssize_t>(payload.size()));
+
+    ByteDeque buffer;
+    ssize_t got = buffer.write_from(fds[0], std::numeric_limits<size_t>::max());
+    CHECK(got == static_cast<ssize_t>(payload.size()));
+    CHECK(buffer.size() == payload.size());
+
+    ::close(fds[1]);
+    CHECK(buffer.write_from(fds[0], 4096) == 0);
+    CHECK(buffer.size() == payload.size());
+
+    int zero = ::open("/dev/zero", O_RDONLY);
+    CHECK(zero >= 0);
+    ByteDeque unbounded;
+    got = unbounded.write_from(zero, std::numeric_limits<size_t>::max());
+    CHECK(got > 0);
+    CHECK(unbounded.size() == static_cast<size_t>(got));
+    ::close(zero);
+    ::close(fds[0]);
+}
+
+// Short reads with a large max land in order across the tail room and the spare chunks.
+// The room they did not fill is kept for the next call, so only the bytes that actually
+// arrived cost new chunks, not the whole max on every call.
+static void test_write_from_short_reads() {
+    int fds[2];
+    CHECK(::pipe(fds) == 0);
+    ByteDeque buffer;
+    buffer.write("head", 4);
+    std::string expected = "head";
+    size_t arrived = 0;
+    for (int i = 0; i < 50; ++i) {
+        std::string piece(100 + i, static_cast<char>('a' + i % 26));
+        CHECK(::write(fds[1], piece.data(), piece.size()) == static_cast<ssize_t>(piece.size()));
+        if (i == 1) {
+            array_allocations = 0;
+        }
+        CHECK(buffer.write_from(fds[0], 65536) == static_cast<ssize_t>(piece.size()));
+        expected += piece;
+        if (i >= 1) {
+            arrived += piece.size();
+        }
+    }
+    CHECK(array_allocations <= arrived / ChunkPool<std::byte>::CHUNK_SIZE + 1);
+    CHECK(buffer.size() == expected.size());
+    std::string out(expected.size(), '\0');
+    CHECK(buffer.read(out.data(), out.size()) == expected.size());
+    CHECK(out == expected);
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+int main() {
+    test_copy_empty();
+    test_copy_offset();
+    test_read_write();
+    test_write_from_unbounded();
+    test_write_from_short_reads();
+    return check_result();
+}
@@ -0,0 +1,95 @@
+#include "Chunk_Map.h"
+#include "check.h"
+
+static Chunk<int> make_chunk(int tag) {
+    Chunk<int> chunk(new int[ChunkPool<int>::CHUNK_SIZE]());
+    chunk[0] = tag;
+    return chunk;
+}
+
+// The last entry only changes address when the entries are moved, so a run of
+// push_front calls may move them a logarithmic number of times, not once per call
+static void test_push_front_moves() {
+    ChunkMap<int> map;
+    map.push_back(make_chunk(0));
+    size_t moves = 0;
+    const Chunk<int>* last = &map.back();
+    for (int i = 1; i <= 100000; ++i) {
+        map.push_front(make_chunk(i));
+        if (&map.back() != last) {
+            ++moves;
+            last = &map.back();
+        }
+    }
+    CHECK(moves <= 20);
+    CHECK(map.size() == 100001);
+    CHECK(map.front()[0] == 100000);
+    CHECK(map.back()[0] == 0);
+    CHECK(map[50000][0] == 50000);
+}
+
+// Reserved front slots are used without moving anything
+static void test_reserve_front() {
+    ChunkMap<int> map;
+    map.push_back(make_chunk(0));
+    map.reserve_front(1000);
+    CHECK(map.front_capacity() >= 1000);
+    const Chunk<int>* last = &map.back();
+    for (int i = 1; i <= 1000; ++i) {
+        map.push_front(make_chunk(i));
+    }
+    CHECK(&map.back() == last);
+    CHECK(map.front()[0] == 1000);
+}
+
+// Used as a FIFO the map reuses the slots freed at the front instead of growing
+static void test_fifo_reuses_slots() {
+    ChunkMap<int> map;
+    for (int i = 0; i < 8; ++i) {
+        map.push_back(make_chunk(i));
+    }
+    for (int i = 8; i < 100000; ++i) {
+        map.push_back(make_chunk(i));
+        map.erase(map.begin(), map.begin() + 1);
+        CHECK(map.front_capacity() <= 64);
+    }
+    CHECK(map.size() == 8);
+    CHECK(map.front()[0] == 99992);
+    CHECK(map.back()[0] == 99999);
+}
+
+static void test_insert_erase_middle() {
+    ChunkMap<int> map;
+    for (int i = 0; i < 4; ++i) {
+        map.push_back(make_chunk(i));
+    }
+    ChunkMap<int>::iterator it = map.insert(map.begin() + 2, make_chunk(10));
+    CHECK((*it)[0] == 10);
+    it = map.insert(map.begin(), make_chunk(11));
+    CHECK(it == map.begin());
+    int expected[] = {11, 0, 1, 10, 2, 3};
+    for (size_t i = 0; i < map.size(); ++i) {
+        CHECK(map[i][0] == expected[i]);
+    }
+    map.erase(map.begin() + 1, map.begin() + 3);
+    CHECK(map.size() == 4);
+    CHECK(map[1][0] == 10);
+    map.erase(map.begin() + 3, map.end());
+    CHECK(map.back()[0] == 2);
+
+    ChunkMap<int> moved(std::move(map));
+    CHECK(map.empty());
+    CHECK(moved.size() == 3);
+    moved.clear();
+    CHECK(moved.empty());
+    moved.push_front(make_chunk(7));
+    CHECK(moved.size() == 1 && moved.front()[0] == 7);
+}
+
+int main() {
+    test_push_front_moves();
+    test_reserve_front();
+    test_fifo_reuses_slots();
+    test_insert_erase_middle();
+    return check_result();
+}
@@ -0,0 +1,81 @@
+#include <string>
+#include "Chunk_Allocator.h"
+#include "check.h"
+#include "counting_pool.h"
+
+// Every chunk comes from the pool and goes back to it, including after a move
+static void test_custom_pool() {
+    CountingPool<std::string> pool;
+    {
+        Deque<std::string> deque;
+        deque.use_chunk_pool(&pool);
+        for (int i = 0; i < 1000; ++i) {
+            deque.push_back(std::to_string(i));
+            deque.push_front(std::to_string(-i));
+        }
+        CHECK(pool.allocated >= 2000 / 128);
+        Deque<std::string> moved(std::move(deque));
+        for (int i = 0; i < 900; ++i) {
+            moved.pop_back();
+        }
+        CHECK(pool.released > 0);
+        CHECK(moved.front() == "-999");
+    }
+    CHECK(pool.released == pool.allocated);
+}
+
+// Chunks from before the switch keep their own deleter
+static void test_switch_sources() {
+    CountingPool<int> pool;
+    Deque<int> deque;
+    for (int i = 0; i < 256; ++i) {
+        deque.push_back(i);
+    }
+    deque.use_chunk_pool(&pool);
+    for (int i = 0; i < 256; ++i) {
+        deque.push_back(i);
+    }
+    deque.use_heap_allocation();
+    for (int i = 0; i < 256; ++i) {
+        deque.push_back(i);
+    }
+    CHECK(pool.allocated == 2);
+    deque.clear();
+    CHECK(pool.released == 2);
+}
+
+static void test_slab_allocation() {
+    Deque<std::string> strings;
+    use_slab_allocation(strings, 0);
+    for (int i = 0; i < 100000; ++i) {
+        strings.push_back(std::to_string(i));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        strings.push_front("x");
+    }
+    CHECK(strings.size() == 101000);
+    CHECK(strings[1000] == "0");
+    CHECK(strings.back() == "99999");
+
+    Deque<int> ints;
+    use_slab_allocation(ints);
+    for (int i = 0; i < 1000; ++i) {
+        ints.push_back(i);
+    }
+    Deque<int> copy(ints);
+    CHECK(copy.back() == 999);
+    while (!ints.empty()) {
+        ints.pop_front();
+    }
+    for (int i = 0; i < 1000; ++i) {
+        ints.push_back(i);
+    }
+    CHECK(ints == copy);
+}
+
+int main() {
+    test_custom_pool();
+    test_switch_sources();
+    test_slab_allocation();
+    return check_result();
+}
@@ -0,0 +1,94 @@
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <tuple>
+#include "Columnar_Deque.h"
+#include "check.h"
+
+// Rows pushed at both ends read back in order, by row and by column
+static void test_rows_and_columns() {
+    ColumnarDeque<int, double, std::string> table;
+    std::deque<std::tuple<int, double, std::string>> expected;
+    std::mt19937 rng(5);
+    for (int i = 0; i < 2000; ++i) {
+        std::tuple<int, double, std::string> row{i, i * 0.5, std::to_string(i)};
+        if (rng() % 3 == 0) {
+            table.push_front(std::get<0>(row), std::get<1>(row), std::get<2>(row));
+            expected.push_front(row);
+        } else {
+            table.push_back(std::get<0>(row), std::get<1>(row), std::get<2>(row));
+            expected.push_back(row);
+        }
+    }
+    CHECK(table.size() == expected.size());
+    bool rows_match = true;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        rows_match = rows_match && std::tuple<int, double, std::string>(table[i]) == expected[i];
+        rows_match = rows_match && table.get<2>(i) == std::get<2>(expected[i]);
+    }
+    CHECK(rows_match);
+
+    long sum = 0;
+    size_t seen = 0;
+    table.for_each_column_segment<0>([&](const int* data, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            sum += data[i];
+        }
+        seen += count;
+    });
+    CHECK(seen == 2000);
+    CHECK(sum == 1999L * 2000 / 2);
+
+    size_t spanned = 0;
+    for (auto span : table.column_segments<1>(100, 500)) {
+        spanned += span.size();
+    }
+    CHECK(spanned == 500);
+}
+
+// Popping resets the removed row, so owning columns let go of their resources
+static void test_pop_releases() {
+    auto shared = std::make_shared<int>(5);
+    ColumnarDeque<int, std::shared_ptr<int>, std::string> table;
+    for (int i = 0; i < 300; ++i) {
+        table.push_back(i, shared, "back");
+        table.push_front(-i, shared, "front");
+    }
+    CHECK(shared.use_count() == 601);
+    table.pop_back();
+    table.pop_front();
+    CHECK(shared.use_count() == 599);
+    while (table.size() > 1) {
+        table.pop_back();
+    }
+    CHECK(shared.use_count() == 2);
+    table.pop_front();
+    CHECK(shared.use_count() == 1);
+    CHECK(table.empty());
+}
+
+static void test_copy_and_iterate() {
+    ColumnarDeque<int, char> table;
+    for (int i = 0; i < 300; ++i) {
+        table.push_back(i, static_cast<char>('a' + i % 26));
+    }
+    ColumnarDeque<int, char> copy(table);
+    table.pop_front();
+    CHECK(copy.size() == 300);
+    CHECK(std::get<0>(copy.front()) == 0);
+
+    int expected = 299;
+    bool reversed = true;
+    for (auto it = copy.rbegin(); it != copy.rend(); ++it) {
+        reversed = reversed && std::get<0>(*it) == expected--;
+    }
+    CHECK(reversed);
+}
+
+int main() {
+    test_rows_and_columns();
+    test_pop_releases();
+    test_copy_and_iterate();
+    return check_result();
+}
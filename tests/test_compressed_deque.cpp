@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+#include "Compressed_Deque.h"
+#include "check.h"
+
+// Random pushes and pops at both ends, with runs of small deltas that pack well
+template <typename T>
+static void test_matches_std() {
+    std::mt19937_64 rng(7);
+    CompressedDeque<T> actual;
+    std::deque<T> expected;
+    bool agrees = true;
+    for (int step = 0; step < 200000; ++step) {
+        int op = static_cast<int>(rng() % 10);
+        T value = static_cast<T>(rng());
+        if (rng() % 2) {
+            value = static_cast<T>((expected.empty() ? 0 : expected.back()) + static_cast<T>(rng() % 5));
+        }
+        if (op < 4) {
+            actual.push_back(value);
+            expected.push_back(value);
+        } else if (op < 7) {
+            actual.push_front(value);
+            expected.push_front(value);
+        } else if (op < 8 && !expected.empty()) {
+            actual.pop_back();
+            expected.pop_back();
+        } else if (op < 9 && !expected.empty()) {
+            actual.pop_front();
+            expected.pop_front();
+        }
+        agrees = agrees && actual.size() == expected.size();
+        if (!expected.empty() && step % 97 == 0) {
+            size_t pos = rng() % expected.size();
+            agrees = agrees && actual[pos] == expected[pos];
+            agrees = agrees && actual.front() == expected.front() && actual.back() == expected.back();
+        }
+    }
+    CHECK(agrees);
+    CHECK(actual.sealed_chunks() > 0);
+
+    std::vector<T> out(expected.size());
+    actual.copy_out(0, out.data(), out.size());
+    CHECK(std::equal(out.begin(), out.end(), expected.begin()));
+    size_t index = 0;
+    bool in_order = true;
+    actual.for_each([&](T value) { in_order = in_order && value == expected[index++]; });
+    CHECK(in_order);
+}
+
+// Regular timestamps compress well; random 64-bit values must not report any savings
+static void test_memory_accounting() {
+    CompressedDeque<uint64_t> timestamps;
+    CompressedDeque<uint64_t> noise;
+    std::mt19937_64 rng(1);
+    uint64_t now = 1700000000000000000ULL;
+    for (int i = 0; i < 1000000; ++i) {
+        now += 1000 + rng() % 50;
+        timestamps.push_back(now);
+        noise.push_back(rng());
+    }
+    CHECK(timestamps.compression_ratio() > 4.0);
+    CHECK(noise.compression_ratio() < 1.0);
+    CHECK(noise.memory_usage() > noise.size() * sizeof(uint64_t));
+
+    timestamps.clear();
+    CHECK(timestamps.empty());
+    CHECK(timestamps.memory_usage() < 64 * 1024);
+}
+
+int main() {
+    test_matches_std<uint64_t>();
+    test_matches_std<int32_t>();
+    test_matches_std<int64_t>();
+    test_matches_std<uint8_t>();
+    test_memory_accounting();
+    return check_result();
+}
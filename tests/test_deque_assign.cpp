@@ -0,0 +1,160 @@
+#include <deque>
+#include <random>
+#include <string>
+#include "Chunk_Allocator.h"
+#include "Chunk_Reclaimer.h"
+#include "Deque.h"
+#include "check.h"
+
+static bool same(const Deque<std::string>& actual, const std::deque<std::string>& expected) {
+    if (actual.size() != expected.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < expected.size(); ++i) {
+        if (actual[i] != expected[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Copy assignment takes the size, contents and destruction policy of the source
+static void test_copy_assign() {
+    Deque<std::string> source, target, empty;
+    for (int i = 0; i < 500; ++i) {
+        source.push_front(std::to_string(i));
+    }
+    source.set_destruction_policy(DestructionPolicy::Deferred);
+    target.push_back("old");
+
+    target = source;
+    CHECK(target.size() == 500);
+    CHECK(target.front() == "499");
+    CHECK(target.back() == "0");
+    CHECK(target.get_destruction_policy() == DestructionPolicy::Deferred);
+    target.pop_front();
+    CHECK(source.size() == 500);
+
+    target = empty;
+    CHECK(target.size() == 0);
+    CHECK(target.empty());
+    target.push_back("again");
+    CHECK(target.size() == 1);
+
+    Deque<std::string>& alias = source;
+    source = alias;
+    CHECK(source.size() == 500);
+    CHECK(source[250] == "249");
+}
+
+// Slab-backed chunks survive being copied and moved between deques
+static void test_assign_keeps_pool() {
+    Deque<int> slab_backed;
+    use_slab_allocation(slab_backed);
+    for (int i = 0; i < 1000; ++i) {
+        slab_backed.push_back(i);
+    }
+    Deque<int> copy;
+    copy = slab_backed;
+    Deque<int> moved;
+    moved = std::move(slab_backed);
+    for (int i = 0; i < 1000; ++i) {
+        copy.push_back(i);
+        moved.push_front(i);
+    }
+    CHECK(copy.size() == 2000);
+    CHECK(moved.size() == 2000);
+    CHECK(copy[999] == 999);
+    CHECK(moved[1000] == 0);
+}
+
+// append_deque, split_at and splice against std::deque at random seams
+static void test_chunk_moves() {
+    std::mt19937 rng(7);
+    for (int round = 0; round < 200; ++round) {
+        Deque<std::string> left, right;
+        std::deque<std::string> expected_left, expected_right;
+        size_t left_size = rng() % 600;
+        size_t right_size = rng() % 600;
+        for (size_t i = 0; i < left_size; ++i) {
+            std::string value = "l" + std::to_string(i);
+            if (rng() % 2) {
+                left.push_back(value);
+                expected_left.push_back(value);
+            } else {
+                left.push_front(value);
+                expected_left.push_front(value);
+            }
+        }
+        for (size_t i = 0; i < right_size; ++i) {
+            std::string value = "r" + std::to_string(i);
+            right.push_back(value);
+            expected_right.push_back(value);
+        }
+
+        switch (round % 3) {
+            case 0:
+                left.append_deque(std::move(right));
+                expected_left.insert(expected_left.end(), expected_right.begin(), expected_right.end());
+                CHECK(right.empty());
+                CHECK(same(left, expected_left));
+                break;
+            case 1: {
+                size_t pos = left_size == 0 ? 0 : rng() % (left_size + 1);
+                Deque<std::string> tail = left.split_at(pos);
+                std::deque<std::string> expected_tail(expected_left.begin() + pos, expected_left.end());
+                expected_left.erase(expected_left.begin() + pos, expected_left.end());
+                CHECK(same(left, expected_left));
+                CHECK(same(tail, expected_tail));
+                break;
+            }
+            default: {
+                size_t pos = left_size == 0 ? 0 : rng() % (left_size + 1);
+                left.splice(pos, std::move(right));
+                expected_left.insert(expected_left.begin() + pos, expected_right.begin(), expected_right.end());
+                CHECK(same(left, expected_left));
+                break;
+            }
+        }
+    }
+}
+
+// Appending at a chunk-aligned seam hands other's chunks over; only real chunks may be retired
+static void test_append_background_slab() {
+    for (size_t front : {128, 100}) {
+        Deque<std::string> left, right;
+        use_slab_allocation(left);
+        use_slab_allocation(right);
+        left.set_destruction_policy(DestructionPolicy::Background);
+        right.set_destruction_policy(DestructionPolicy::Background);
+        for (size_t i = 0; i < front; ++i) {
+            left.push_back("left");
+        }
+        // Start right at the same slot where left's tail ends, so the seams line up
+        for (size_t i = 0; i < front % 128; ++i) {
+            right.push_back("pad");
+        }
+        for (int i = 0; i < 300; ++i) {
+            right.push_back(std::to_string(i));
+        }
+        for (size_t i = 0; i < front % 128; ++i) {
+            right.pop_front();
+        }
+        left.append_deque(std::move(right));
+        ChunkReclaimer::instance().flush();
+        CHECK(right.empty());
+        CHECK(left.size() == front + 300);
+        CHECK(left[front] == "0");
+        CHECK(left.back() == "299");
+        right.push_back("reused");
+        CHECK(right.front() == "reused");
+    }
+}
+
+int main() {
+    test_copy_assign();
+    test_assign_keeps_pool();
+    test_chunk_moves();
+    test_append_background_slab();
+    return check_result();
+}
@@ -0,0 +1,123 @@
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include "Chunk_Reclaimer.h"
+#include "Deque.h"
+#include "check.h"
+
+// Erase at random positions, comparing contents, size and the returned iterator
+static void test_erase_matches_std() {
+    std::mt19937 rng(1);
+    Deque<std::string> actual;
+    std::deque<std::string> expected;
+    for (int i = 0; i < 1000; ++i) {
+        std::string value = std::string(40, static_cast<char>('a' + i % 26)) + std::to_string(i);
+        if (i % 2) {
+            actual.push_back(value);
+            expected.push_back(value);
+        } else {
+            actual.push_front(value);
+            expected.push_front(value);
+        }
+    }
+    while (!expected.empty()) {
+        size_t pos = rng() % expected.size();
+        auto next = actual.erase(actual.begin() + pos);
+        expected.erase(expected.begin() + pos);
+        CHECK(actual.size() == expected.size());
+        if (pos < expected.size()) {
+            CHECK(*next == expected[pos]);
+        } else {
+            CHECK(next == actual.end());
+        }
+        for (size_t i = 0; i < expected.size(); i += 17) {
+            CHECK(actual[i] == expected[i]);
+        }
+    }
+    CHECK(actual.empty());
+}
+
+// Under Immediate, erasing or popping drops the element's resources right away
+static void test_erase_releases() {
+    auto shared = std::make_shared<int>(1);
+    Deque<std::shared_ptr<int>> deque;
+    for (int i = 0; i < 300; ++i) {
+        deque.push_back(shared);
+    }
+    CHECK(shared.use_count() == 301);
+    deque.erase(deque.begin() + 150);
+    CHECK(deque.size() == 299);
+    CHECK(shared.use_count() == 300);
+    deque.erase(deque.begin());
+    deque.erase(deque.end() - 1);
+    CHECK(shared.use_count() == 298);
+    deque.pop_front();
+    deque.pop_back();
+    CHECK(shared.use_count() == 296);
+}
+
+// Deferred keeps popped elements alive until their chunk goes; Background frees it off-thread
+static void test_deferred_and_background() {
+    auto shared = std::make_shared<int>(2);
+    Deque<std::shared_ptr<int>> deferred;
+    deferred.set_destruction_policy(DestructionPolicy::Deferred);
+    for (int i = 0; i < 256; ++i) {
+        deferred.push_back(shared);
+    }
+    deferred.pop_back();
+    CHECK(shared.use_count() == 257);
+    for (int i = 0; i < 127; ++i) {
+        deferred.pop_back();
+    }
+    CHECK(shared.use_count() == 129);
+
+    Deque<std::shared_ptr<int>> background;
+    background.set_destruction_policy(DestructionPolicy::Background);
+    for (int i = 0; i < 256; ++i) {
+        background.push_back(shared);
+    }
+    for (int i = 0; i < 128; ++i) {
+        background.pop_back();
+    }
+    ChunkReclaimer::instance().flush();
+    CHECK(shared.use_count() == 257);
+}
+
+// Draining a deque parks its last chunk for reuse; that must not keep popped elements alive
+static void test_drained_deque_releases() {
+    for (DestructionPolicy policy : {DestructionPolicy::Immediate, DestructionPolicy::Deferred,
+                                     DestructionPolicy::Background}) {
+        auto shared = std::make_shared<int>(3);
+        Deque<std::shared_ptr<int>> deque;
+        deque.set_destruction_policy(policy);
+        for (int i = 0; i < 100; ++i) {
+            deque.push_back(shared);
+        }
+        for (int i = 0; i < 100; ++i) {
+            deque.pop_front();
+        }
+        deque.clear();
+        ChunkReclaimer::instance().flush();
+        CHECK(shared.use_count() == 1);
+
+        for (int i = 0; i < 100; ++i) {
+            deque.push_back(shared);
+        }
+        for (int i = 0; i < 100; ++i) {
+            deque.pop_back();
+        }
+        ChunkReclaimer::instance().flush();
+        CHECK(shared.use_count() == 1);
+        deque.push_back(shared);
+        CHECK(shared.use_count() == 2);
+    }
+}
+
+int main() {
+    test_erase_matches_std();
+    test_erase_releases();
+    test_deferred_and_background();
+    test_drained_deque_releases();
+    return check_result();
+}
@@ -0,0 +1,131 @@
+#include <cstdlib>
+#include <fcntl.h>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include "Deque_IO.h"
+#include "Mapped_Deque.h"
+#include "check.h"
+
+static std::string temp_path(const char* name) {
+    const char* dir = std::getenv("TMPDIR");
+    return std::string(dir ? dir : "/tmp") + "/" + name + "." + std::to_string(::getpid());
+}
+
+static Deque<long> sample() {
+    Deque<long> deque;
+    for (long i = 0; i < 1000; ++i) {
+        deque.push_back(i);
+    }
+    for (long i = 1; i <= 300; ++i) {
+        deque.push_front(-i);
+    }
+    return deque;
+}
+
+static void test_stream_round_trip() {
+    Deque<long> original = sample();
+    std::stringstream stream;
+    original.save(stream);
+    Deque<long> loaded;
+    loaded.load(stream);
+    CHECK(loaded == original);
+
+    Deque<long> empty, empty_loaded;
+    std::stringstream empty_stream;
+    empty.save(empty_stream);
+    empty_loaded.push_back(1);
+    empty_loaded.load(empty_stream);
+    CHECK(empty_loaded.empty());
+}
+
+// The fd writer produces the stream layout, so MappedDeque can view it in place
+static void test_fd_round_trip_and_mapping() {
+    Deque<long> original = sample();
+    std::string path = temp_path("deque_io");
+    int fd = ::open(path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+    CHECK(fd >= 0);
+    save(original, fd);
+    ::close(fd);
+
+    {
+        MappedDeque<long> mapped(path);
+        CHECK(mapped.size() == original.size());
+        CHECK(mapped.front() == -300);
+        CHECK(mapped.back() == 999);
+        CHECK(mapped.verify());
+        size_t total = 0;
+        for (size_t i = 0; i < mapped.chunk_count(); ++i) {
+            total += mapped.chunk_length(i);
+        }
+        CHECK(total == original.size());
+    }
+
+    Deque<long> loaded;
+    fd = ::open(path.c_str(), O_RDONLY);
+    load(loaded, fd);
+    ::close(fd);
+    CHECK(loaded == original);
+    loaded.push_front(-301);
+    CHECK(loaded.front() == -301);
+    ::unlink(path.c_str());
+}
+
+// Flipping a payload byte is caught by the checksum and leaves the target empty
+static void test_corruption_detected() {
+    std::stringstream stream;
+    sample().save(stream);
+    std::string bytes = stream.str();
+    bytes[DequeFileHeader::DATA_OFFSET + 5] ^= 0x40;
+    std::stringstream corrupted(bytes);
+    Deque<long> target;
+    bool threw = false;
+    try {
+        target.load(corrupted);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    CHECK(threw);
+    CHECK(target.empty());
+
+    std::stringstream truncated(bytes.substr(0, bytes.size() / 2));
+    threw = false;
+    try {
+        target.load(truncated);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    CHECK(threw);
+}
+
+// export_iovec hands out one buffer per chunk touched, export_spans the same as spans
+static void test_export() {
+    Deque<int> deque;
+    for (int i = 0; i < 1050; ++i) {
+        deque.push_back(i);
+    }
+    iovec iov[64];
+    size_t count = export_iovec(deque, iov, 64);
+    size_t bytes = 0;
+    for (size_t i = 0; i < count; ++i) {
+        bytes += iov[i].iov_len;
+    }
+    CHECK(count == 9);
+    CHECK(bytes == 1050 * sizeof(int));
+    CHECK(export_iovec(deque, iov, 2, 100) == 2);
+    CHECK(iov[0].iov_len == 28 * sizeof(int));
+
+    deque.consume_front(300);
+    CHECK(deque.front() == 300);
+    CHECK(deque.export_spans().size() == 7);
+    deque.consume_front(750);
+    CHECK(deque.empty());
+}
+
+int main() {
+    test_stream_round_trip();
+    test_fd_round_trip_and_mapping();
+    test_corruption_detected();
+    test_export();
+    return check_result();
+}
@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <deque>
+#include <random>
+#include "Deque.h"
+#include "check.h"
+
+// Forward, reverse and const traversals, iterator arithmetic and for_each_reverse against a model
+static bool traversals_match(Deque<long>& deque, const std::deque<long>& expected) {
+    const Deque<long>& view = deque;
+    bool ok = true;
+    size_t i = 0;
+    for (auto it = deque.begin(); it != deque.end(); ++it, ++i) {
+        ok = ok && i < expected.size() && *it == expected[i];
+    }
+    ok = ok && i == expected.size();
+    i = 0;
+    for (long value : view) {
+        ok = ok && value == expected[i++];
+    }
+    i = expected.size();
+    for (auto it = deque.rbegin(); it != deque.rend(); ++it) {
+        ok = ok && i > 0 && *it == expected[--i];
+    }
+    ok = ok && i == 0;
+    i = expected.size();
+    for (auto it = view.crbegin(); it != view.crend(); ++it) {
+        ok = ok && i > 0 && *it == expected[--i];
+    }
+    ok = ok && static_cast<size_t>(deque.end() - deque.begin()) == expected.size();
+    ok = ok && static_cast<size_t>(deque.rend() - deque.rbegin()) == expected.size();
+    ok = ok && static_cast<size_t>(view.cend() - view.cbegin()) == expected.size();
+
+    long size = static_cast<long>(expected.size());
+    for (long k = 0; k < size; k += 37) {
+        ok = ok && *(deque.begin() + k) == expected[k];
+        ok = ok && *(deque.rbegin() + k) == expected[size - 1 - k];
+        ok = ok && *(deque.end() - (k + 1)) == expected[size - 1 - k];
+        ok = ok && deque.begin()[k] == expected[k];
+        ok = ok && deque.begin() + k < deque.end();
+    }
+    if (size > 0) {
+        auto last = deque.end();
+        --last;
+        ok = ok && *last == expected.back();
+        auto first = deque.rend();
+        --first;
+        ok = ok && *first == expected.front();
+    }
+
+    i = expected.size();
+    view.for_each_reverse([&](const long& value) { ok = ok && i > 0 && value == expected[--i]; });
+    return ok && i == 0;
+}
+
+static void test_random_shapes() {
+    std::mt19937 rng(9);
+    Deque<long> deque;
+    std::deque<long> expected;
+    bool ok = true;
+    for (int step = 0; step < 20000; ++step) {
+        int op = static_cast<int>(rng() % 6);
+        long value = static_cast<long>(rng() % 1000);
+        if (op < 2) {
+            deque.push_back(value);
+            expected.push_back(value);
+        } else if (op < 4) {
+            deque.push_front(value);
+            expected.push_front(value);
+        } else if (op == 4 && !expected.empty()) {
+            deque.pop_back();
+            expected.pop_back();
+        } else if (!expected.empty()) {
+            deque.pop_front();
+            expected.pop_front();
+        }
+        if (step % 500 == 0) {
+            ok = ok && traversals_match(deque, expected);
+        }
+    }
+    CHECK(ok);
+    CHECK(traversals_match(deque, expected));
+
+    std::sort(deque.begin(), deque.end());
+    std::sort(expected.begin(), expected.end());
+    CHECK(traversals_match(deque, expected));
+    std::reverse(deque.begin(), deque.end());
+    std::reverse(expected.begin(), expected.end());
+    CHECK(traversals_match(deque, expected));
+}
+
+static void test_empty() {
+    Deque<long> deque;
+    std::deque<long> expected;
+    CHECK(deque.begin() == deque.end());
+    CHECK(deque.rbegin() == deque.rend());
+    CHECK(traversals_match(deque, expected));
+}
+
+int main() {
+    test_random_shapes();
+    test_empty();
+    return check_result();
+}
@@ -0,0 +1,77 @@
+#include "Deque.h"
+#include "check.h"
+#include "counting_pool.h"
+
+// Reserved room is used before any new chunk is allocated
+static void test_reserve_back() {
+    CountingPool<long> pool;
+    Deque<long> deque;
+    deque.use_chunk_pool(&pool);
+    deque.reserve_back(200000);
+    CHECK(deque.capacity_back() >= 200000);
+    size_t reserved = pool.allocated;
+    for (long i = 0; i < 200000; ++i) {
+        deque.push_back(i);
+    }
+    CHECK(pool.allocated == reserved);
+    CHECK(deque[199999] == 199999);
+    CHECK(deque[12345] == 12345);
+}
+
+static void test_reserve_front() {
+    CountingPool<long> pool;
+    Deque<long> deque;
+    deque.use_chunk_pool(&pool);
+    deque.push_back(-1);
+    deque.reserve_front(100000);
+    CHECK(deque.capacity_front() >= 100000);
+    size_t reserved = pool.allocated;
+    for (long i = 0; i < 100000; ++i) {
+        deque.push_front(i);
+    }
+    CHECK(pool.allocated == reserved);
+    CHECK(deque.back() == -1);
+    CHECK(deque.front() == 99999);
+    CHECK(deque[1] == 99998);
+
+    deque.shrink_to_fit();
+    CHECK(deque.capacity_front() < 128); // Only the free slots of the front chunk remain
+    Deque<long> moved = std::move(deque);
+    moved.pop_back();
+    moved.consume_front(moved.size() - 3);
+    CHECK(moved.size() == 3);
+    CHECK(moved.front() == 2);
+}
+
+// An empty deque with only front reserve can still grow at the back, and the other way round
+static void test_reserve_either_end() {
+    CountingPool<int> pool;
+    Deque<int> deque;
+    deque.use_chunk_pool(&pool);
+    deque.reserve_front(300);
+    size_t reserved = pool.allocated;
+    deque.push_back(1);
+    CHECK(pool.allocated == reserved);
+    deque.pop_back();
+
+    for (int i = 0; i < 300; ++i) {
+        deque.push_front(i);
+    }
+    bool in_order = true;
+    for (int i = 0; i < 300; ++i) {
+        in_order = in_order && deque.back() == i;
+        deque.pop_back();
+    }
+    CHECK(in_order);
+    deque.clear();
+    deque.shrink_to_fit();
+    CHECK(deque.capacity_front() == 0 && deque.capacity_back() == 0);
+    CHECK(pool.released == pool.allocated);
+}
+
+int main() {
+    test_reserve_back();
+    test_reserve_front();
+    test_reserve_either_end();
+    return check_result();
+}
@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+#include "Deque.h"
+#include "check.h"
+
+// Nearly sorted arrivals and sorted batches keep the deque ordered like std::merge would
+static void test_sorted_insert_and_merge() {
+    std::mt19937 rng(1);
+    Deque<int> actual;
+    std::deque<int> expected;
+    for (int i = 0; i < 5000; ++i) {
+        int value = i * 10 - static_cast<int>(rng() % 200);
+        actual.sorted_insert(value);
+        expected.insert(std::upper_bound(expected.begin(), expected.end(), value), value);
+    }
+    for (int i = 0; i < 200; ++i) {
+        actual.push_front(-100000);
+        expected.push_front(-100000);
+    }
+    for (int round = 0; round < 50; ++round) {
+        std::vector<int> batch;
+        for (int k = 0; k < 300; ++k) {
+            batch.push_back(static_cast<int>(rng() % 60000));
+        }
+        std::sort(batch.begin(), batch.end());
+        actual.merge_sorted(batch.begin(), batch.end());
+        std::vector<int> merged;
+        std::merge(expected.begin(), expected.end(), batch.begin(), batch.end(), std::back_inserter(merged));
+        expected.assign(merged.begin(), merged.end());
+    }
+    CHECK(actual.size() == expected.size());
+    bool agrees = true;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        agrees = agrees && actual[i] == expected[i];
+    }
+    CHECK(agrees);
+}
+
+// Equal keys land after existing ones, and a custom comparator orders descending
+static void test_stability_and_comparator() {
+    Deque<std::pair<int, int>> stable;
+    auto by_key = [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; };
+    for (int i = 0; i < 10; ++i) {
+        stable.sorted_insert({i % 3, i}, by_key);
+    }
+    CHECK(stable[0] == std::make_pair(0, 0));
+    CHECK(stable[1] == std::make_pair(0, 3));
+    CHECK(stable[3] == std::make_pair(0, 9));
+    CHECK(stable.back() == std::make_pair(2, 8));
+
+    Deque<int> descending;
+    for (int value : {3, 9, 1, 7}) {
+        descending.sorted_insert(value, std::greater<int>());
+    }
+    CHECK(descending[0] == 9 && descending[1] == 7 && descending[2] == 3 && descending[3] == 1);
+    CHECK(descending.sorted_insert(5, std::greater<int>()) == 2);
+}
+
+int main() {
+    test_sorted_insert_and_merge();
+    test_stability_and_comparator();
+    return check_result();
+}
@@ -0,0 +1,88 @@
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include "Deque.h"
+#include "check.h"
+
+static void test_try_pop() {
+    Deque<int> deque;
+    int out = -1;
+    CHECK(!deque.try_pop_front(out));
+    CHECK(!deque.try_pop_back(out));
+    CHECK(out == -1);
+    CHECK(!deque.try_pop_front());
+
+    for (int i = 0; i < 1000; ++i) {
+        deque.push_back(i);
+    }
+    long sum = 0;
+    while (deque.try_pop_front(out)) {
+        sum += out;
+    }
+    CHECK(sum == 999L * 1000 / 2);
+    CHECK(deque.empty());
+
+    for (int i = 0; i < 300; ++i) {
+        deque.push_front(i);
+    }
+    std::optional<int> last = deque.try_pop_back();
+    CHECK(last == 0);
+    CHECK(deque[5] == 294);
+    while (deque.try_pop_back()) {
+    }
+    CHECK(deque.empty());
+}
+
+// The unchecked variants see the same elements as the checked ones
+static void test_unchecked_access() {
+    Deque<std::string> deque;
+    for (int i = 0; i < 300; ++i) {
+        deque.push_back(std::to_string(i));
+        deque.push_front(std::to_string(-i));
+    }
+    CHECK(deque.unchecked_front() == deque.front());
+    CHECK(deque.unchecked_back() == deque.back());
+    const Deque<std::string>& view = deque;
+    CHECK(view.unchecked_front() == "-299");
+    CHECK(view.unchecked_back() == "299");
+
+    while (deque.size() > 2) {
+        deque.unchecked_pop_front();
+        deque.unchecked_pop_back();
+    }
+    CHECK(deque.front() == "0");
+    CHECK(deque.back() == "0");
+    deque.unchecked_pop_back();
+    deque.unchecked_pop_front();
+    CHECK(deque.empty());
+    deque.push_back("again");
+    CHECK(deque.unchecked_front() == "again");
+}
+
+template <typename F>
+static bool throws_out_of_range(F&& f) {
+    try {
+        f();
+    } catch (const std::out_of_range&) {
+        return true;
+    }
+    return false;
+}
+
+// The checked versions throw on an empty deque or a bad index
+static void test_checked_errors() {
+    Deque<int> deque;
+    CHECK(throws_out_of_range([&] { deque.pop_front(); }));
+    CHECK(throws_out_of_range([&] { deque.pop_back(); }));
+    CHECK(throws_out_of_range([&] { deque.front(); }));
+    deque.push_back(1);
+    CHECK(throws_out_of_range([&] { deque.at(1); }));
+    CHECK(deque.size() == 1);
+}
+
+int main() {
+    test_try_pop();
+    test_unchecked_access();
+    test_checked_errors();
+    return check_result();
+}
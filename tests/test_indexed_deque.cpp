@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <string>
+#include <utility>
+#include "Indexed_Deque.h"
+#include "check.h"
+
+// Random pushes, pops and cancellations against a std::deque of key/value pairs
+static void test_matches_std() {
+    std::mt19937 rng(5);
+    IndexedDeque<int, std::string> actual;
+    std::deque<std::pair<int, std::string>> expected;
+    bool agrees = true;
+    for (int step = 0; step < 300000; ++step) {
+        int op = static_cast<int>(rng() % 10);
+        int key = static_cast<int>(rng() % 5000);
+        auto queued = std::find_if(expected.begin(), expected.end(), [&](const auto& entry) {
+            return entry.first == key;
+        });
+        if (op < 5) {
+            bool pushed = actual.push_back(key, std::to_string(key));
+            agrees = agrees && pushed == (queued == expected.end());
+            if (pushed) {
+                expected.emplace_back(key, std::to_string(key));
+            }
+        } else if (op < 7 && !expected.empty()) {
+            agrees = agrees && actual.front_key() == expected.front().first;
+            agrees = agrees && actual.front() == expected.front().second;
+            actual.pop_front();
+            expected.pop_front();
+        } else {
+            bool cancelled = actual.cancel(key);
+            agrees = agrees && cancelled == (queued != expected.end());
+            if (cancelled) {
+                expected.erase(queued);
+            }
+        }
+        agrees = agrees && actual.size() == expected.size();
+        if (step % 1000 == 0) {
+            size_t index = 0;
+            actual.for_each([&](const int& k, const std::string& v) {
+                agrees = agrees && index < expected.size() && k == expected[index].first &&
+                         v == expected[index].second;
+                ++index;
+            });
+            agrees = agrees && index == expected.size();
+            for (const auto& entry : expected) {
+                const std::string* found = actual.find(entry.first);
+                agrees = agrees && found && *found == entry.second;
+            }
+        }
+    }
+    CHECK(agrees);
+}
+
+// Cancelling most of a long queue from the middle compacts it without losing order
+static void test_mass_cancel() {
+    IndexedDeque<int, int> queue;
+    for (int i = 0; i < 10000; ++i) {
+        CHECK(queue.push_back(i, i * 2));
+    }
+    for (int i = 0; i < 10000; ++i) {
+        if (i % 10 != 0) {
+            CHECK(queue.cancel(i));
+        }
+    }
+    CHECK(queue.size() == 1000);
+    CHECK(!queue.contains(5));
+    CHECK(!queue.cancel(5));
+    CHECK(queue.push_back(5, 10));
+    int expected = 0;
+    bool in_order = true;
+    while (queue.size() > 1) {
+        in_order = in_order && queue.front_key() == expected && queue.front() == expected * 2;
+        queue.pop_front();
+        expected += 10;
+    }
+    CHECK(in_order);
+    CHECK(queue.front_key() == 5);
+    queue.clear();
+    CHECK(queue.empty());
+    CHECK(!queue.find(5));
+}
+
+int main() {
+    test_matches_std();
+    test_mass_cancel();
+    return check_result();
+}
@@ -0,0 +1,78 @@
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "Persistent_Deque.h"
+#include "check.h"
+
+// Every version stays valid after later versions are derived from it
+static void test_versions_are_immutable() {
+    std::mt19937 rng(11);
+    std::vector<PersistentDeque<int>> versions{PersistentDeque<int>()};
+    std::vector<std::deque<int>> expected{{}};
+    for (int step = 0; step < 30000; ++step) {
+        size_t base = rng() % 4 ? versions.size() - 1 : rng() % versions.size();
+        PersistentDeque<int> version = versions[base];
+        std::deque<int> model = expected[base];
+        int op = static_cast<int>(rng() % 10);
+        int value = static_cast<int>(rng());
+        if (op < 3) {
+            version = version.push_back(value);
+            model.push_back(value);
+        } else if (op < 6) {
+            version = version.push_front(value);
+            model.push_front(value);
+        } else if (op < 7 && !model.empty()) {
+            version = version.pop_back();
+            model.pop_back();
+        } else if (op < 8 && !model.empty()) {
+            version = version.pop_front();
+            model.pop_front();
+        } else if (!model.empty()) {
+            size_t pos = rng() % model.size();
+            version = version.set(pos, value);
+            model[pos] = value;
+        }
+        versions.push_back(version);
+        expected.push_back(model);
+    }
+
+    bool agrees = true;
+    for (size_t v = 0; v < versions.size(); v += 37) {
+        const PersistentDeque<int>& version = versions[v];
+        const std::deque<int>& model = expected[v];
+        agrees = agrees && version.size() == model.size();
+        for (size_t i = 0; agrees && i < model.size(); ++i) {
+            agrees = version[i] == model[i];
+        }
+        size_t index = 0;
+        version.for_each([&](const int& value) {
+            agrees = agrees && index < model.size() && value == model[index];
+            ++index;
+        });
+    }
+    CHECK(agrees);
+}
+
+static void test_empty_and_bounds() {
+    PersistentDeque<int> empty;
+    CHECK(empty.empty());
+    PersistentDeque<int> one = empty.push_back(1);
+    CHECK(one.size() == 1);
+    CHECK(empty.size() == 0);
+    CHECK(one.front() == 1 && one.back() == 1);
+    CHECK(one.pop_front().empty());
+    bool threw = false;
+    try {
+        one.at(1);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    CHECK(threw);
+}
+
+int main() {
+    test_versions_are_immutable();
+    test_empty_and_bounds();
+    return check_result();
+}
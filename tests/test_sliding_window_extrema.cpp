@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+#include "Sliding_Window_Extrema.h"
+#include "check.h"
+
+// Minimum and maximum agree with a brute-force scan of the last window_size values
+static void test_matches_brute_force() {
+    std::mt19937 rng(3);
+    for (size_t window : {1, 10, 1000}) {
+        SlidingWindowExtrema<int> minimum(window);
+        SlidingWindowExtrema<int, std::greater<int>> maximum(window);
+        std::vector<int> values;
+        bool agrees = true;
+        for (int i = 0; i < 20000; ++i) {
+            int value = static_cast<int>(rng() % 1000);
+            values.push_back(value);
+            minimum.push(value);
+            maximum.push(value);
+            size_t first = values.size() > window ? values.size() - window : 0;
+            agrees = agrees && minimum.extremum() == *std::min_element(values.begin() + first, values.end());
+            agrees = agrees && maximum.extremum() == *std::max_element(values.begin() + first, values.end());
+        }
+        CHECK(agrees);
+        CHECK(minimum.count() == window);
+    }
+}
+
+// Decreasing input keeps replacing the only candidate; increasing input fills the whole window
+static void test_monotonic_input() {
+    SlidingWindowExtrema<long> decreasing(64);
+    for (long i = 0; i < 100000; ++i) {
+        decreasing.push(-i);
+        if (decreasing.extremum() != -i) {
+            CHECK(decreasing.extremum() == -i);
+            break;
+        }
+    }
+    SlidingWindowExtrema<long> increasing(64);
+    for (long i = 0; i < 100000; ++i) {
+        increasing.push(i);
+    }
+    CHECK(increasing.extremum() == 100000 - 64);
+}
+
+static void test_clear() {
+    SlidingWindowExtrema<int> window(5);
+    CHECK(window.empty());
+    window.push(3);
+    window.push(1);
+    CHECK(window.extremum() == 1);
+    CHECK(window.count() == 2);
+    window.clear();
+    CHECK(window.empty());
+    CHECK(window.count() == 0);
+    window.push(9);
+    CHECK(window.extremum() == 9);
+    CHECK(window.window() == 5);
+}
+
+int main() {
+    test_matches_brute_force();
+    test_monotonic_input();
+    test_clear();
+    return check_result();
+}
@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <string>
+#include "Spilling_Deque.h"
+#include "check.h"
+
+static std::string temp_dir() {
+    const char* dir = std::getenv("TMPDIR");
+    return dir ? dir : "/tmp";
+}
+
+// A budget of a few chunks forces the interior out to disk and back
+static void test_matches_std() {
+    std::mt19937 rng(3);
+    SpillingDeque<uint64_t> actual(64 * 1024, temp_dir(), 2);
+    std::deque<uint64_t> expected;
+    bool agrees = true;
+    size_t most_spilled = 0;
+    for (int step = 0; step < 400000; ++step) {
+        int op = static_cast<int>(rng() % 10);
+        uint64_t value = rng();
+        if (op < 4) {
+            actual.push_back(value);
+            expected.push_back(value);
+        } else if (op < 6) {
+            actual.push_front(value);
+            expected.push_front(value);
+        } else if (op < 8 && !expected.empty()) {
+            agrees = agrees && actual.back() == expected.back();
+            actual.pop_back();
+            expected.pop_back();
+        } else if (!expected.empty()) {
+            agrees = agrees && actual.front() == expected.front();
+            actual.pop_front();
+            expected.pop_front();
+        }
+        agrees = agrees && actual.size() == expected.size();
+        if (step % 1000 == 0) {
+            most_spilled = std::max(most_spilled, actual.spilled_chunks());
+        }
+    }
+    CHECK(agrees);
+    CHECK(most_spilled > 0);
+
+    while (!expected.empty()) {
+        agrees = agrees && actual.front() == expected.front();
+        actual.pop_front();
+        expected.pop_front();
+    }
+    CHECK(agrees);
+    CHECK(actual.empty());
+    CHECK(actual.spilled_chunks() == 0);
+}
+
+// FIFO use: everything pushed comes back in order from the far end
+static void test_fifo_drain() {
+    SpillingDeque<uint64_t> queue(256 * 1024, temp_dir());
+    const uint64_t count = 1 << 20;
+    for (uint64_t i = 0; i < count; ++i) {
+        queue.push_back(i);
+    }
+    CHECK(queue.spilled_chunks() > 0);
+    bool in_order = true;
+    for (uint64_t i = 0; i < count; ++i) {
+        in_order = in_order && queue.front() == i;
+        queue.pop_front();
+    }
+    CHECK(in_order);
+    CHECK(queue.empty());
+}
+
+int main() {
+    test_matches_std();
+    test_fifo_drain();
+    return check_result();
+}
@@ -0,0 +1,65 @@
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include "Static_Deque.h"
+#include "check.h"
+
+// The whole interface is usable in constant expressions
+constexpr int wrap_and_iterate() {
+    StaticDeque<int, 8> deque;
+    for (int i = 0; i < 6; ++i) {
+        deque.push_back(i);
+    }
+    deque.push_front(-1);
+    deque.pop_back();
+    int sum = 0;
+    for (auto it = deque.begin(); it != deque.end(); ++it) {
+        sum += *it;
+    }
+    for (auto it = deque.rbegin(); it != deque.rend(); ++it) {
+        sum += *it;
+    }
+    return sum + deque.back() * 100;
+}
+static_assert(wrap_and_iterate() == 18 + 400);
+
+constexpr int sliding_ring() {
+    StaticDeque<int, 5> deque;
+    for (int i = 0; i < 20; ++i) {
+        deque.push_back(i);
+        if (deque.full()) {
+            deque.pop_front();
+        }
+    }
+    return deque.front() * 10 + static_cast<int>(deque.size());
+}
+static_assert(sliding_ring() == 164);
+
+static void test_runtime_types() {
+    StaticDeque<std::string, 3> deque;
+    deque.push_back("a");
+    deque.push_front("b");
+    CHECK(deque[0] == "b");
+    CHECK(deque[1] == "a");
+
+    StaticDeque<std::string, 3> copy = deque;
+    CHECK(copy == deque);
+    CHECK(std::accumulate(copy.begin(), copy.end(), std::string()) == "ba");
+
+    deque.push_back("c");
+    CHECK(deque.full());
+    bool threw = false;
+    try {
+        deque.push_back("d");
+    } catch (const std::exception&) {
+        threw = true;
+    }
+    CHECK(threw);
+    CHECK(deque.size() == 3);
+    CHECK(copy.size() == 2);
+}
+
+int main() {
+    test_runtime_types();
+    return check_result();
+}